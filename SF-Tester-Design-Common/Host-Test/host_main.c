@@ -0,0 +1,394 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file host_main.c
+ *
+ * @brief
+ * Host harness of the SF3 test engine. The engine runs against the mock
+ * FreeRTOS and the in-memory N25Q model behind the mock PmodSF3 driver, with
+ * its transfer task and a print task of the terminal log on their own threads.
+ * The harness steps the FSM of the device task as Experiment_prvSf3Task() does,
+ * presses button 0 to start each fast mode iteration of test pattern A, and
+ * checks the result of each scenario of injected faults. It reports the erase,
+ * program and verify pages per second and CPU cycles per page of the clean
+ * iteration; these are host figures under the latencies of the model.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+/* The harness steps the private FSM of the engine, so it builds it in. */
+#include "Experiment.c"
+
+#include <stdlib.h>
+#include "sf3_console.h"
+#include "mock_n25q.h"
+
+/* An iteration that has not completed within the timeout fails. */
+#define HOST_RUN_TIMEOUT_MS 60000
+/* The text of the terminal log captured for the checks of an iteration */
+#define HOST_CAPTURE_SZ 16384
+/* Any nonzero error count is expected of the scenario. */
+#define HOST_ERRORS_ANY 0xFFFFFFFF
+
+enum HOST_FAULT_TAG {
+	HOST_FAULT_NONE,
+	HOST_FAULT_STUCK_LOW,
+	HOST_FAULT_PROGRAM_ERR,
+	HOST_FAULT_ERASE_DELAY
+};
+
+/* A fault injected at an offset from the start address of the iteration, and
+ * the error count and terminal log text expected of the iteration. */
+typedef struct HOST_SCENARIO_TAG {
+	const char* name;
+	int fault;
+	u32 faultOffset;
+	u32 expectErrors;
+	const char* expectText;
+} t_host_scenario;
+
+/* Pattern A programs the byte of page offset N with N, so clearing bit 2 of
+ * the byte at offset 0x34 of a page fails that one byte. The erase delay is
+ * longer than the 3 second timeout of the sector erase, so the iteration ends
+ * failed once the erase completes, without programming or reading. */
+static const t_host_scenario c_host_scenarios[] = {
+	{"clean", HOST_FAULT_NONE, 0, 0, NULL},
+	{"stuck low bit", HOST_FAULT_STUCK_LOW, 0x00001234, 1, "MAP bits 04 hi 00 lo 04"},
+	{"program error", HOST_FAULT_PROGRAM_ERR, 0x00002000, HOST_ERRORS_ANY, "FSR Err 90"},
+	{"erase timeout", HOST_FAULT_ERASE_DELAY, 0x00030000, 0, "Ers Tout"}
+};
+
+#define HOST_SCENARIO_COUNT (sizeof(c_host_scenarios) / sizeof(c_host_scenarios[0]))
+
+#define HOST_ERASE_DELAY_US 3500000
+
+/* The queues of the board main, which the engine sends to and receives from */
+QueueHandle_t xQueueLedConfig = NULL;
+QueueHandle_t xQueueClsDispl = NULL;
+QueueHandle_t xQueueSf3Xfer[SF3_DEVICE_COUNT];
+QueueHandle_t xQueueSf3XferDone[SF3_DEVICE_COUNT];
+
+static char hostCapture[HOST_CAPTURE_SZ];
+static u32 hostCaptureLen = 0;
+
+/* The state of the device task kept across its loop passes */
+typedef struct HOST_TASK_STATE_TAG {
+	TickType_t xPeriodStartTime;
+	bool bInputEvent;
+} t_host_task_state;
+
+/*-----------------------------------------------------------*/
+/* Print the terminal log as the print task of the board does, and capture it
+ * for the checks of the iteration. */
+static void Host_prvPrintTask(void *pvParameters)
+{
+	char line[LOG_LINE_SZ + 1];
+	u32 lineLen;
+
+	Console_Init();
+
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		while (Log_FormatNext(line, LOG_LINE_SZ)) {
+			lineLen = strnlen(line, LOG_LINE_SZ);
+			line[lineLen++] = '\n';
+			Console_Write(line, lineLen);
+
+			taskENTER_CRITICAL();
+			if (hostCaptureLen + lineLen < HOST_CAPTURE_SZ) {
+				memcpy(&(hostCapture[hostCaptureLen]), line, lineLen);
+				hostCaptureLen += lineLen;
+				hostCapture[hostCaptureLen] = '\0';
+			}
+			taskEXIT_CRITICAL();
+		}
+
+		fflush(stdout);
+	}
+}
+
+/* Discard the display updates, which the LED and CLS tasks would show. */
+static void Host_drainDisplayQueues(void)
+{
+	t_rgb_led_palette_silk ledUpdate;
+	t_cls_lines clsUpdate;
+
+	while (xQueueReceive(xQueueLedConfig, &ledUpdate, 0) == pdPASS) {
+	}
+
+	while (xQueueReceive(xQueueClsDispl, &clsUpdate, 0) == pdPASS) {
+	}
+}
+
+/* Initialize the device as Experiment_prvSf3Task() does before its loop. */
+static void Host_initTask(t_experiment_data* expData, t_host_task_state* state)
+{
+	XStatus Status;
+
+	experiInputTasks[0] = xTaskGetCurrentTaskHandle();
+
+	Status = Board_Sf3Begin(&(sf3Device[0]), 0);
+
+	if (Status != XST_SUCCESS) {
+		Log_Event(0, LOG_EVENT_SF3_FAIL, (UINTPTR) Status, 0, 0, 0);
+	}
+
+	Timing_Init();
+	Experiment_InitData(expData, 0);
+
+#if SF3_RESULT_STREAM && SF3_KERNEL_BENCHMARK
+	Experiment_benchmarkKernels(expData);
+#endif
+
+	XGpio_Initialize(&(expData->axGpio), USERIO_DEVICE_ID);
+	XGpio_SetDataDirection(&(expData->axGpio), SWTCH_SW_CHANNEL, SWTCHS_SWS_MASK);
+	XGpio_SetDataDirection(&(expData->axGpio), BTNS_SW_CHANNEL, BTNS_SWS_MASK);
+
+	Status = Board_UserInputsBegin(&(expData->axGpio),
+			Experiment_userInputsHandler, &(expData->axGpio));
+	experiInputIntrEnabled = (Status == XST_SUCCESS);
+	experiSharedInitDone = true;
+
+	/* Fast mode, as selected in setup mode, steps on the flag status. */
+	expData->sf3_fast_mode = true;
+
+	state->xPeriodStartTime = xTaskGetTickCount();
+	state->bInputEvent = false;
+}
+
+/* Run one pass of the loop of Experiment_prvSf3Task(). */
+static void Host_stepTask(t_experiment_data* expData, t_host_task_state* state)
+{
+	const TickType_t x10millisecond = pdMS_TO_TICKS( DELAY_1_SECOND / 100 );
+	bool bPeriodElapsed;
+
+	bPeriodElapsed = ((xTaskGetTickCount() - state->xPeriodStartTime) >= x10millisecond);
+
+	if (bPeriodElapsed) {
+		state->xPeriodStartTime = xTaskGetTickCount();
+
+		Experiment_updateLedsDisplayMode(expData);
+		Experiment_updateLedsStatuses(expData);
+		Experiment_updateClsDisplayAndTerminal(expData);
+		Host_drainDisplayQueues();
+	}
+
+	if ((bPeriodElapsed) || (state->bInputEvent) || (Experiment_isActivePhase(expData)) ||
+			(Experiment_isSetupStep(expData))) {
+		Experiment_readUserInputs(expData);
+
+		expData->step_start_tick = xTaskGetTickCount();
+		Experiment_operateFSM(expData);
+	}
+
+	if (bPeriodElapsed) {
+		Experiment_iterationTimer(expData);
+	}
+
+	if ((Experiment_isErasePending(expData)) ||
+			((Experiment_isActivePhase(expData)) && (Experiment_isStepBudgetSpent(expData)))) {
+		state->bInputEvent = false;
+		vTaskDelay(1);
+	} else if (Experiment_isActivePhase(expData)) {
+		state->bInputEvent = false;
+		taskYIELD();
+	} else if (Experiment_isSetupStep(expData)) {
+		state->bInputEvent = false;
+	} else {
+		state->bInputEvent = Experiment_waitPeriodOrInput(expData, state->xPeriodStartTime,
+				x10millisecond);
+	}
+}
+
+static void Host_injectFault(const t_host_scenario* scenario, u32 startAddr)
+{
+	const u32 faultAddr = startAddr + scenario->faultOffset;
+
+	switch (scenario->fault) {
+	case HOST_FAULT_STUCK_LOW:
+		MockN25q_InjectStuckLow(faultAddr, 0x04);
+		break;
+	case HOST_FAULT_PROGRAM_ERR:
+		MockN25q_InjectProgramError(faultAddr);
+		break;
+	case HOST_FAULT_ERASE_DELAY:
+		MockN25q_InjectEraseDelay(faultAddr, HOST_ERASE_DELAY_US);
+		break;
+	default:
+		break;
+	}
+}
+
+/* Press and release button 0 to start an iteration, inject the fault of the
+ * scenario once the iteration has chosen its start address, and step until
+ * the iteration has displayed its result and waits for a button again. */
+static bool Host_runIteration(t_experiment_data* expData, t_host_task_state* state,
+		const t_host_scenario* scenario)
+{
+	const TickType_t startTick = xTaskGetTickCount();
+	bool bStarted = false;
+	bool bInjected = false;
+	bool bFinal = false;
+
+	MockGpio_SetInputs(BTNS_SW_CHANNEL, BTN0_MASK);
+
+	while (! ((bFinal) && (expData->operatingMode == ST_WAIT_BUTTON_DEP))) {
+		if (xTaskGetTickCount() - startTick >= pdMS_TO_TICKS(HOST_RUN_TIMEOUT_MS)) {
+			printf("HOST %s: timed out in mode %d\n", scenario->name, expData->operatingMode);
+			return false;
+		}
+
+		Host_stepTask(expData, state);
+
+		if ((! bStarted) && (expData->operatingMode == ST_WAIT_BUTTON_REL)) {
+			MockGpio_SetInputs(BTNS_SW_CHANNEL, 0x00000000);
+			bStarted = true;
+		}
+
+		if ((! bInjected) && (expData->operatingMode == ST_SET_START_WAIT)) {
+			Host_injectFault(scenario, expData->sf3_addr_start_val);
+			bInjected = true;
+		}
+
+		if (expData->operatingMode == ST_DISPLAY_FINAL) {
+			bFinal = true;
+		}
+	}
+
+	/* Let the print task format the last lines of the iteration. */
+	vTaskDelay(pdMS_TO_TICKS(100));
+	return true;
+}
+
+/* Report the pages per second and the CPU cycles per page of a phase. */
+static void Host_reportPhase(const char* label, const t_timing_phase* phase)
+{
+	const u32 pageCount = (u32)(phase->byteCount / SF3_PAGE_SIZE);
+	const u32 us = Timing_TicksToUs(phase->elapsedTicks);
+
+	printf("HOST %s %lu pages %lu us %lu pages/s %lu cycles/page\n", label,
+			(unsigned long) pageCount, (unsigned long) us,
+			(unsigned long)((us) ? (((u64) pageCount * 1000000ULL) / us) : 0),
+			(unsigned long)((pageCount) ? Timing_TicksToCpuCycles(phase->elapsedTicks / pageCount) : 0));
+}
+
+static bool Host_checkIteration(const t_experiment_data* expData, const t_host_scenario* scenario)
+{
+	const u32 errCount = expData->sf3_err_count_val - expData->sf3_iter_err_count_base;
+	const u32 expectAddr = expData->sf3_addr_start_val + scenario->faultOffset;
+	bool pass = true;
+
+	if ((scenario->expectErrors == HOST_ERRORS_ANY) ? (errCount == 0) :
+			(errCount != scenario->expectErrors)) {
+		printf("HOST %s: %lu errors\n", scenario->name, (unsigned long) errCount);
+		pass = false;
+	}
+
+	if ((scenario->fault == HOST_FAULT_STUCK_LOW) &&
+			((! expData->sf3_first_fail_valid) || (expData->sf3_first_fail_addr != expectAddr))) {
+		printf("HOST %s: first failure not at %08lx\n", scenario->name, (unsigned long) expectAddr);
+		pass = false;
+	}
+
+	if ((scenario->fault == HOST_FAULT_ERASE_DELAY) &&
+			((! expData->sf3_iter_aborted) || (expData->sf3_test_pass) ||
+			(expData->timing_program.byteCount != 0))) {
+		printf("HOST %s: iteration not ended at the erase timeout\n", scenario->name);
+		pass = false;
+	}
+
+	taskENTER_CRITICAL();
+	if ((scenario->expectText != NULL) && (strstr(hostCapture, scenario->expectText) == NULL)) {
+		printf("HOST %s: no \"%s\" in the log\n", scenario->name, scenario->expectText);
+		pass = false;
+	}
+	taskEXIT_CRITICAL();
+
+	return pass;
+}
+
+/*-----------------------------------------------------------*/
+int main(void)
+{
+	t_experiment_data* expData = &(experiData[0]);
+	t_host_task_state state;
+	TaskHandle_t xPrintTask = NULL;
+	u32 failCount = 0;
+
+	setvbuf(stdout, NULL, _IOLBF, 0);
+
+	xQueueLedConfig = xQueueCreate(10, sizeof(t_rgb_led_palette_silk));
+	xQueueClsDispl = xQueueCreate(4, sizeof(t_cls_lines));
+	xQueueSf3Xfer[0] = xQueueCreate(SF3_XFER_BUFFER_COUNT, sizeof(t_sf3_xfer));
+	xQueueSf3XferDone[0] = xQueueCreate(SF3_XFER_BUFFER_COUNT, sizeof(t_sf3_xfer));
+
+	MockN25q_Reset();
+
+	xTaskCreate(Host_prvPrintTask, "PRNT", configMINIMAL_STACK_SIZE, NULL,
+			tskIDLE_PRIORITY + 1, &xPrintTask);
+	Log_Init(xPrintTask);
+
+	xTaskCreate(Experiment_prvSf3XferTask, "SF3X", configMINIMAL_STACK_SIZE, (void*)(UINTPTR) 0,
+			tskIDLE_PRIORITY + 1, NULL);
+
+	Host_initTask(expData, &state);
+
+	for (u32 iScenario = 0; iScenario < HOST_SCENARIO_COUNT; ++iScenario) {
+		const t_host_scenario* scenario = &(c_host_scenarios[iScenario]);
+		bool pass;
+
+		printf("HOST %s\n", scenario->name);
+
+		MockN25q_Reset();
+		taskENTER_CRITICAL();
+		hostCaptureLen = 0;
+		hostCapture[0] = '\0';
+		taskEXIT_CRITICAL();
+
+		pass = (Host_runIteration(expData, &state, scenario)) &&
+				(Host_checkIteration(expData, scenario));
+
+		if (scenario->fault == HOST_FAULT_NONE) {
+			Host_reportPhase("ERS", &(expData->timing_erase));
+			Host_reportPhase("PRO", &(expData->timing_program));
+			Host_reportPhase("TST", &(expData->timing_read));
+		}
+
+		printf("HOST %s: %s\n", scenario->name, (pass) ? "PASS" : "FAIL");
+		failCount += (pass) ? 0 : 1;
+	}
+
+	printf("HOST %lu of %lu scenarios failed\n", (unsigned long) failCount,
+			(unsigned long) HOST_SCENARIO_COUNT);
+
+	return (failCount == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
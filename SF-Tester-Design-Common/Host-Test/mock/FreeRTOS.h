@@ -0,0 +1,82 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file FreeRTOS.h
+ *
+ * @brief
+ * Host mock of the FreeRTOS kernel configuration and port, running each
+ * task as a POSIX thread with a tick of one millisecond.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef HOST_MOCK_FREERTOS_H_
+#define HOST_MOCK_FREERTOS_H_
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "xil_types.h"
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef void (*TaskFunction_t)(void* pvParameters);
+
+#define pdFALSE ((BaseType_t) 0)
+#define pdTRUE ((BaseType_t) 1)
+#define pdFAIL (pdFALSE)
+#define pdPASS (pdTRUE)
+
+#define portMAX_DELAY ((TickType_t) 0xFFFFFFFFUL)
+
+#define configTICK_RATE_HZ 1000
+#define configMINIMAL_STACK_SIZE 256
+#define configMAX_TASK_NAME_LEN 16
+#define tskIDLE_PRIORITY 0
+#define portTICK_PERIOD_MS ((TickType_t) 1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(xTimeInMs) \
+	((TickType_t)(((uint64_t)(xTimeInMs) * (uint64_t) configTICK_RATE_HZ) / 1000U))
+
+#define configASSERT(x) assert(x)
+#define portYIELD_FROM_ISR(x) ((void)(x))
+
+BaseType_t xPortInstallInterruptHandler(uint8_t ucInterruptID, XInterruptHandler pxHandler,
+		void* pvCallBackRef);
+void vPortEnableInterrupt(uint8_t ucInterruptID);
+
+/* Host mock only: enter the handler installed for the interrupt, on the
+ * thread of the caller, as the end of a transfer would on the board. */
+void vMockRaiseInterrupt(uint8_t ucInterruptID);
+void vMockEnterCritical(void);
+void vMockExitCritical(void);
+
+#endif /* HOST_MOCK_FREERTOS_H_ */
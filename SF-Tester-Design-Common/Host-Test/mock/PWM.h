@@ -0,0 +1,45 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file PWM.h
+ *
+ * @brief
+ * Host mock of the Digilent PWM driver header, unused by the SF3 test engine.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef HOST_MOCK_PWM_H_
+#define HOST_MOCK_PWM_H_
+
+#include "xil_types.h"
+
+#endif /* HOST_MOCK_PWM_H_ */
@@ -0,0 +1,85 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file PmodSF3.h
+ *
+ * @brief
+ * Host mock of the FreeRTOS PmodSF3 driver, transferring with the in-memory
+ * N25Q model of mock_n25q.c. The command framing is that of the driver:
+ * the command and three address bytes lead the buffer, and the driver adds
+ * the dummy bytes of its own fast, dual and quad read commands.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef HOST_MOCK_PMODSF3_H_
+#define HOST_MOCK_PMODSF3_H_
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xspi.h"
+
+#define SF3_COMMAND_WRITE_ENABLE 0x06
+#define SF3_COMMAND_STATUSREG_READ 0x05
+#define SF3_COMMAND_PAGE_PROGRAM 0x02
+#define SF3_COMMAND_SECTOR_ERASE 0x20
+#define SF3_COMMAND_BULK_ERASE 0xC7
+#define SF3_COMMAND_RANDOM_READ 0x03
+#define SF3_COMMAND_FAST_READ 0x0B
+#define SF3_COMMAND_DUAL_READ 0x3B
+#define SF3_COMMAND_DUAL_IO_READ 0xBB
+#define SF3_COMMAND_QUAD_READ 0x6B
+#define SF3_COMMAND_QUAD_IO_READ 0xEB
+
+#define SF3_FAST_READ_DUMMY_BYTES 1
+#define SF3_DUAL_READ_DUMMY_BYTES 2
+#define SF3_DUAL_IO_READ_DUMMY_BYTES 2
+#define SF3_QUAD_READ_DUMMY_BYTES 4
+#define SF3_QUAD_IO_READ_DUMMY_BYTES 5
+
+#define SF3_PAGE_SIZE 256
+#define SF3_WRITE_EXTRA_BYTES 4
+#define SF3_READ_MIN_EXTRA_BYTES 4
+
+#define SF3_FLASH_SR_IS_READY_MASK 0x01
+
+typedef struct PmodSF3 {
+	XSpi SF3Spi;
+	u8 IntrVecId;
+} PmodSF3;
+
+XStatus SF3_begin_freertos(PmodSF3* InstancePtr, u32 SpiBaseAddr, u32 IntcVecId, u32 QspiIntr);
+XStatus SF3_FlashWriteEnable(PmodSF3* InstancePtr);
+XStatus SF3_BulkErase(PmodSF3* InstancePtr);
+XStatus SF3_FlashWrite(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 WriteCmd, u8** BufferPtr);
+XStatus SF3_FlashRead(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 ReadCmd, u8** BufferPtr);
+
+#endif /* HOST_MOCK_PMODSF3_H_ */
@@ -0,0 +1,360 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file mock_freertos.c
+ *
+ * @brief
+ * Host mock of the FreeRTOS task, notification and queue API and of its
+ * MicroBlaze port, over POSIX threads. Each task runs on its own thread from
+ * its creation; a thread not created as a task, such as that of main(), has a
+ * task handle made for it on first use. The tick is the millisecond of the
+ * host monotonic clock, and the critical sections hold one recursive mutex.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#define MOCK_INTERRUPT_COUNT 32
+
+typedef struct MOCK_TASK_TAG {
+	pthread_t thread;
+	TaskFunction_t taskCode;
+	void* parameters;
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	uint32_t notifyCount;
+} t_mock_task;
+
+typedef struct MOCK_QUEUE_TAG {
+	pthread_mutex_t mutex;
+	pthread_cond_t notEmpty;
+	pthread_cond_t notFull;
+	UBaseType_t length;
+	UBaseType_t itemSize;
+	UBaseType_t head;
+	UBaseType_t count;
+	u8* storage;
+} t_mock_queue;
+
+typedef struct MOCK_INTERRUPT_TAG {
+	XInterruptHandler handler;
+	void* callbackRef;
+} t_mock_interrupt;
+
+static __thread t_mock_task* mockCurrentTask = NULL;
+static pthread_mutex_t mockCriticalMutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static t_mock_interrupt mockInterrupts[MOCK_INTERRUPT_COUNT];
+
+static void MockCondInit(pthread_cond_t* cond)
+{
+	pthread_condattr_t attr;
+
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(cond, &attr);
+	pthread_condattr_destroy(&attr);
+}
+
+static struct timespec MockDeadline(TickType_t xTicksToWait)
+{
+	struct timespec ts;
+	const uint64_t ms = ((uint64_t) xTicksToWait * 1000U) / configTICK_RATE_HZ;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ts.tv_sec += (time_t)(ms / 1000U);
+	ts.tv_nsec += (long)((ms % 1000U) * 1000000UL);
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec += 1;
+		ts.tv_nsec -= 1000000000L;
+	}
+
+	return ts;
+}
+
+/* Wait on the condition until woken, or until the deadline as not forever.
+ * Return false once the deadline has passed. */
+static bool MockCondWait(pthread_cond_t* cond, pthread_mutex_t* mutex,
+		TickType_t xTicksToWait, const struct timespec* deadline)
+{
+	if (xTicksToWait == portMAX_DELAY) {
+		pthread_cond_wait(cond, mutex);
+		return true;
+	}
+
+	return (pthread_cond_timedwait(cond, mutex, deadline) != ETIMEDOUT);
+}
+
+static t_mock_task* MockTaskNew(TaskFunction_t pxTaskCode, void* pvParameters)
+{
+	t_mock_task* task = calloc(1, sizeof(t_mock_task));
+
+	configASSERT(task);
+	task->taskCode = pxTaskCode;
+	task->parameters = pvParameters;
+	pthread_mutex_init(&(task->mutex), NULL);
+	MockCondInit(&(task->cond));
+
+	return task;
+}
+
+static void* MockTaskThread(void* arg)
+{
+	t_mock_task* task = (t_mock_task*) arg;
+
+	mockCurrentTask = task;
+	task->taskCode(task->parameters);
+
+	return NULL;
+}
+
+/*------------------ Tasks and notifications ----------------*/
+/*-----------------------------------------------------------*/
+BaseType_t xTaskCreate(TaskFunction_t pxTaskCode, const char* const pcName,
+		const uint16_t usStackDepth, void* const pvParameters,
+		UBaseType_t uxPriority, TaskHandle_t* const pxCreatedTask)
+{
+	t_mock_task* task = MockTaskNew(pxTaskCode, pvParameters);
+
+	if (pxCreatedTask != NULL) {
+		*pxCreatedTask = task;
+	}
+
+	if (pthread_create(&(task->thread), NULL, MockTaskThread, task) != 0) {
+		return pdFAIL;
+	}
+
+	pthread_detach(task->thread);
+	return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+	if (mockCurrentTask == NULL) {
+		mockCurrentTask = MockTaskNew(NULL, NULL);
+		mockCurrentTask->thread = pthread_self();
+	}
+
+	return mockCurrentTask;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+	static uint64_t startMs = 0;
+	struct timespec ts;
+	uint64_t nowMs;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	nowMs = ((uint64_t) ts.tv_sec * 1000U) + ((uint64_t) ts.tv_nsec / 1000000U);
+
+	if (startMs == 0) {
+		startMs = nowMs;
+	}
+
+	return (TickType_t)(((nowMs - startMs) * configTICK_RATE_HZ) / 1000U);
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+	const struct timespec deadline = MockDeadline(xTicksToDelay);
+
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+	}
+}
+
+void vTaskDelayUntil(TickType_t* const pxPreviousWakeTime, const TickType_t xTimeIncrement)
+{
+	const TickType_t elapsed = xTaskGetTickCount() - *pxPreviousWakeTime;
+
+	*pxPreviousWakeTime += xTimeIncrement;
+
+	if (elapsed < xTimeIncrement) {
+		vTaskDelay(xTimeIncrement - elapsed);
+	}
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+	t_mock_task* task = xTaskGetCurrentTaskHandle();
+	const struct timespec deadline = MockDeadline(xTicksToWait);
+	uint32_t count;
+
+	pthread_mutex_lock(&(task->mutex));
+	while ((task->notifyCount == 0) && (xTicksToWait != 0) &&
+			(MockCondWait(&(task->cond), &(task->mutex), xTicksToWait, &deadline))) {
+	}
+
+	count = task->notifyCount;
+	if (count != 0) {
+		task->notifyCount = (xClearCountOnExit) ? 0 : (count - 1);
+	}
+	pthread_mutex_unlock(&(task->mutex));
+
+	return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+	pthread_mutex_lock(&(xTaskToNotify->mutex));
+	xTaskToNotify->notifyCount++;
+	pthread_cond_signal(&(xTaskToNotify->cond));
+	pthread_mutex_unlock(&(xTaskToNotify->mutex));
+
+	return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken)
+{
+	xTaskNotifyGive(xTaskToNotify);
+
+	if (pxHigherPriorityTaskWoken != NULL) {
+		*pxHigherPriorityTaskWoken = pdTRUE;
+	}
+}
+
+/*------------------ Queues ---------------------------------*/
+/*-----------------------------------------------------------*/
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+	t_mock_queue* queue = calloc(1, sizeof(t_mock_queue));
+
+	if (queue == NULL) {
+		return NULL;
+	}
+
+	queue->length = uxQueueLength;
+	queue->itemSize = uxItemSize;
+	queue->storage = calloc(uxQueueLength, (uxItemSize) ? uxItemSize : 1);
+	pthread_mutex_init(&(queue->mutex), NULL);
+	MockCondInit(&(queue->notEmpty));
+	MockCondInit(&(queue->notFull));
+
+	return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t xQueue, const void* const pvItemToQueue,
+		TickType_t xTicksToWait)
+{
+	const struct timespec deadline = MockDeadline(xTicksToWait);
+	UBaseType_t tail;
+
+	pthread_mutex_lock(&(xQueue->mutex));
+	while (xQueue->count == xQueue->length) {
+		if ((xTicksToWait == 0) ||
+				(! MockCondWait(&(xQueue->notFull), &(xQueue->mutex), xTicksToWait, &deadline))) {
+			pthread_mutex_unlock(&(xQueue->mutex));
+			return pdFAIL;
+		}
+	}
+
+	tail = (xQueue->head + xQueue->count) % xQueue->length;
+	if (xQueue->itemSize != 0) {
+		memcpy(&(xQueue->storage[tail * xQueue->itemSize]), pvItemToQueue, xQueue->itemSize);
+	}
+	xQueue->count++;
+	pthread_cond_signal(&(xQueue->notEmpty));
+	pthread_mutex_unlock(&(xQueue->mutex));
+
+	return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void* const pvBuffer, TickType_t xTicksToWait)
+{
+	const struct timespec deadline = MockDeadline(xTicksToWait);
+
+	pthread_mutex_lock(&(xQueue->mutex));
+	while (xQueue->count == 0) {
+		if ((xTicksToWait == 0) ||
+				(! MockCondWait(&(xQueue->notEmpty), &(xQueue->mutex), xTicksToWait, &deadline))) {
+			pthread_mutex_unlock(&(xQueue->mutex));
+			return pdFAIL;
+		}
+	}
+
+	if (xQueue->itemSize != 0) {
+		memcpy(pvBuffer, &(xQueue->storage[xQueue->head * xQueue->itemSize]), xQueue->itemSize);
+	}
+	xQueue->head = (xQueue->head + 1) % xQueue->length;
+	xQueue->count--;
+	pthread_cond_signal(&(xQueue->notFull));
+	pthread_mutex_unlock(&(xQueue->mutex));
+
+	return pdPASS;
+}
+
+/*------------------ Port -----------------------------------*/
+/*-----------------------------------------------------------*/
+BaseType_t xPortInstallInterruptHandler(uint8_t ucInterruptID, XInterruptHandler pxHandler,
+		void* pvCallBackRef)
+{
+	if (ucInterruptID >= MOCK_INTERRUPT_COUNT) {
+		return pdFAIL;
+	}
+
+	vMockEnterCritical();
+	mockInterrupts[ucInterruptID].handler = pxHandler;
+	mockInterrupts[ucInterruptID].callbackRef = pvCallBackRef;
+	vMockExitCritical();
+
+	return pdPASS;
+}
+
+void vPortEnableInterrupt(uint8_t ucInterruptID)
+{
+	(void) ucInterruptID;
+}
+
+void vMockRaiseInterrupt(uint8_t ucInterruptID)
+{
+	if ((ucInterruptID < MOCK_INTERRUPT_COUNT) && (mockInterrupts[ucInterruptID].handler != NULL)) {
+		mockInterrupts[ucInterruptID].handler(mockInterrupts[ucInterruptID].callbackRef);
+	}
+}
+
+void vMockEnterCritical(void)
+{
+	pthread_mutex_lock(&mockCriticalMutex);
+}
+
+void vMockExitCritical(void)
+{
+	pthread_mutex_unlock(&mockCriticalMutex);
+}
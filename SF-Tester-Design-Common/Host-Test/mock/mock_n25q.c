@@ -0,0 +1,431 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file mock_n25q.c
+ *
+ * @brief
+ * Host mock of the FreeRTOS PmodSF3 driver, with an in-memory model of the
+ * N25Q behind it. The model erases, programs and reads its memory as the N25Q
+ * does, stays busy for the latency of each program and erase, and reports the
+ * completion and the errors of each in its status and flag status registers.
+ * As the driver does, each transfer other than a register read waits first
+ * for the N25Q to be ready, and raises the QSPI interrupt as it completes.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "PmodSF3.h"
+#include "mock_n25q.h"
+
+#define MOCK_N25Q_SUBSECTOR_SIZE 4096
+#define MOCK_N25Q_SECTOR_SIZE 65536
+
+#define MOCK_N25Q_COMMAND_READ_FLAG_STATUS_REG 0x70
+#define MOCK_N25Q_COMMAND_DIE_ERASE 0xC4
+#define MOCK_N25Q_COMMAND_SECTOR_ERASE 0xD8
+#define MOCK_N25Q_COMMAND_READ_4BYTE 0x13
+#define MOCK_N25Q_COMMAND_PAGE_PROGRAM_4BYTE 0x12
+#define MOCK_N25Q_COMMAND_QUAD_INPUT_PROGRAM 0x32
+#define MOCK_N25Q_COMMAND_QUAD_INPUT_PROGRAM_4BYTE 0x34
+#define MOCK_N25Q_COMMAND_SUBSECTOR_ERASE_4BYTE 0x21
+#define MOCK_N25Q_COMMAND_SECTOR_ERASE_4BYTE 0xDC
+#define MOCK_N25Q_COMMAND_DUAL_OUTPUT_READ_4BYTE 0x3C
+#define MOCK_N25Q_COMMAND_DUAL_IO_READ_4BYTE 0xBC
+#define MOCK_N25Q_COMMAND_QUAD_OUTPUT_READ_4BYTE 0x6C
+#define MOCK_N25Q_COMMAND_QUAD_IO_READ_4BYTE 0xEC
+
+#define MOCK_N25Q_STATUS_WIP_MASK 0x01
+#define MOCK_N25Q_STATUS_WEL_MASK 0x02
+#define MOCK_N25Q_FLAG_STATUS_READY_MASK 0x80
+#define MOCK_N25Q_FLAG_STATUS_ERASE_ERR_MASK 0x20
+#define MOCK_N25Q_FLAG_STATUS_PROGRAM_ERR_MASK 0x10
+
+/* Framing of a read or write command, in the lanes of its data */
+typedef struct MOCK_N25Q_FRAME_TAG {
+	u32 addr;
+	u32 headerBytes;
+	u32 dataBytes;
+	u32 lanes;
+} t_mock_n25q_frame;
+
+typedef struct MOCK_N25Q_MODEL_TAG {
+	u8 memory[MOCK_N25Q_BYTE_COUNT];
+	t_mock_n25q_timing timing;
+	bool writeEnabled;
+	u8 flagErrors;
+	u64 busyUntilNs;
+	bool stuckValid;
+	u32 stuckAddr;
+	u8 stuckMask;
+	bool programErrValid;
+	u32 programErrAddr;
+	bool eraseDelayValid;
+	u32 eraseDelayAddr;
+	u32 eraseDelayUs;
+} t_mock_n25q_model;
+
+static t_mock_n25q_model mockN25q = {
+	.timing = MOCK_N25Q_TIMING_DEFAULT
+};
+static pthread_mutex_t mockN25qMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static u64 MockN25q_NowNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((u64) ts.tv_sec * 1000000000ULL) + (u64) ts.tv_nsec;
+}
+
+static u64 MockN25q_ScaledNs(u64 us)
+{
+	const u32 scale = (mockN25q.timing.timeScale) ? mockN25q.timing.timeScale : 1;
+
+	return (us * 1000ULL) / scale;
+}
+
+/* Spin for the SPI clocks of the transfer, as the driver blocks for them. */
+static void MockN25q_Transfer(const PmodSF3* InstancePtr, u32 byteCount, u32 lanes)
+{
+	u64 endNs;
+
+	if (mockN25q.timing.sckHz != 0) {
+		endNs = MockN25q_NowNs() + MockN25q_ScaledNs(
+				((u64) byteCount * 8ULL * 1000000ULL) / ((u64) lanes * mockN25q.timing.sckHz));
+
+		while (MockN25q_NowNs() < endNs) {
+			sched_yield();
+		}
+	}
+
+	vMockRaiseInterrupt(InstancePtr->IntrVecId);
+}
+
+static bool MockN25q_IsBusy(void)
+{
+	bool busy;
+
+	pthread_mutex_lock(&mockN25qMutex);
+	busy = (MockN25q_NowNs() < mockN25q.busyUntilNs);
+	pthread_mutex_unlock(&mockN25qMutex);
+
+	return busy;
+}
+
+/* The driver polls the status register until the N25Q is ready. */
+static void MockN25q_WaitForReady(void)
+{
+	while (MockN25q_IsBusy()) {
+		sched_yield();
+	}
+}
+
+/* Frame a command from the buffer, as the driver and the engine lay it out:
+ * the 4-byte address commands carry the low address byte after the three of
+ * the driver, and the dummy bytes of the driver's own read commands are added
+ * by the driver. */
+static t_mock_n25q_frame MockN25q_Frame(u32 Addr, u32 ByteCount, u8 Cmd, const u8* Buffer)
+{
+	t_mock_n25q_frame frame = {Addr & 0x00FFFFFF, SF3_WRITE_EXTRA_BYTES, ByteCount, 1};
+	u32 dummyBytes = 0;
+	bool addr4Byte = false;
+
+	switch (Cmd) {
+	case SF3_COMMAND_FAST_READ: dummyBytes = SF3_FAST_READ_DUMMY_BYTES; break;
+	case SF3_COMMAND_DUAL_READ: dummyBytes = SF3_DUAL_READ_DUMMY_BYTES; frame.lanes = 2; break;
+	case SF3_COMMAND_DUAL_IO_READ: dummyBytes = SF3_DUAL_IO_READ_DUMMY_BYTES; frame.lanes = 2; break;
+	case SF3_COMMAND_QUAD_READ: dummyBytes = SF3_QUAD_READ_DUMMY_BYTES; frame.lanes = 4; break;
+	case SF3_COMMAND_QUAD_IO_READ: dummyBytes = SF3_QUAD_IO_READ_DUMMY_BYTES; frame.lanes = 4; break;
+	case MOCK_N25Q_COMMAND_QUAD_INPUT_PROGRAM: frame.lanes = 4; break;
+	case MOCK_N25Q_COMMAND_QUAD_INPUT_PROGRAM_4BYTE:
+		addr4Byte = true;
+		frame.lanes = 4;
+		break;
+	case MOCK_N25Q_COMMAND_READ_4BYTE:
+	case MOCK_N25Q_COMMAND_PAGE_PROGRAM_4BYTE:
+	case MOCK_N25Q_COMMAND_SUBSECTOR_ERASE_4BYTE:
+	case MOCK_N25Q_COMMAND_SECTOR_ERASE_4BYTE:
+		addr4Byte = true;
+		break;
+	case MOCK_N25Q_COMMAND_DUAL_OUTPUT_READ_4BYTE:
+	case MOCK_N25Q_COMMAND_DUAL_IO_READ_4BYTE:
+		addr4Byte = true;
+		dummyBytes = SF3_DUAL_READ_DUMMY_BYTES;
+		frame.lanes = 2;
+		break;
+	case MOCK_N25Q_COMMAND_QUAD_OUTPUT_READ_4BYTE:
+		addr4Byte = true;
+		dummyBytes = SF3_QUAD_READ_DUMMY_BYTES;
+		frame.lanes = 4;
+		break;
+	case MOCK_N25Q_COMMAND_QUAD_IO_READ_4BYTE:
+		addr4Byte = true;
+		dummyBytes = SF3_QUAD_IO_READ_DUMMY_BYTES;
+		frame.lanes = 4;
+		break;
+	default:
+		break;
+	}
+
+	if (addr4Byte) {
+		/* The engine counts its address byte and dummy bytes in the data. */
+		frame.addr = (frame.addr << 8) | Buffer[SF3_WRITE_EXTRA_BYTES];
+		frame.headerBytes += 1 + dummyBytes;
+		frame.dataBytes = (ByteCount > 1 + dummyBytes) ? (ByteCount - 1 - dummyBytes) : 0;
+	} else {
+		frame.headerBytes += dummyBytes;
+	}
+
+	return frame;
+}
+
+/* Start the program or erase latency, or the slower injected erase delay. */
+static void MockN25q_StartBusy(u64 latencyUs, u32 eraseAddr, u32 eraseByteCount)
+{
+	u64 latencyNs = MockN25q_ScaledNs(latencyUs);
+
+	if ((eraseByteCount != 0) && (mockN25q.eraseDelayValid) &&
+			(mockN25q.eraseDelayAddr - eraseAddr < eraseByteCount)) {
+		latencyNs = (u64) mockN25q.eraseDelayUs * 1000ULL;
+	}
+
+	mockN25q.busyUntilNs = MockN25q_NowNs() + latencyNs;
+	mockN25q.writeEnabled = false;
+}
+
+static void MockN25q_Erase(u32 addr, u32 byteCount, u32 latencyUs)
+{
+	addr &= ~(byteCount - 1);
+
+	if (addr < MOCK_N25Q_BYTE_COUNT) {
+		memset(&(mockN25q.memory[addr]), 0xFF, byteCount);
+	}
+
+	MockN25q_StartBusy(latencyUs, addr, byteCount);
+}
+
+/* Program the bytes, which only clear bits, wrapping within the page. */
+static void MockN25q_Program(u32 addr, const u8* data, u32 byteCount)
+{
+	const u32 pageAddr = addr & ~(SF3_PAGE_SIZE - 1);
+
+	if ((mockN25q.programErrValid) && ((mockN25q.programErrAddr & ~(SF3_PAGE_SIZE - 1)) == pageAddr)) {
+		mockN25q.flagErrors |= MOCK_N25Q_FLAG_STATUS_PROGRAM_ERR_MASK;
+	} else if (pageAddr < MOCK_N25Q_BYTE_COUNT) {
+		for (u32 i = 0; i < byteCount; ++i) {
+			mockN25q.memory[pageAddr + ((addr + i) % SF3_PAGE_SIZE)] &= data[i];
+		}
+	}
+
+	MockN25q_StartBusy(mockN25q.timing.pageProgramUs, 0, 0);
+}
+
+/*------------------ Mock PmodSF3 driver --------------------*/
+/*-----------------------------------------------------------*/
+XStatus SF3_begin_freertos(PmodSF3* InstancePtr, u32 SpiBaseAddr, u32 IntcVecId, u32 QspiIntr)
+{
+	InstancePtr->SF3Spi.BaseAddress = SpiBaseAddr;
+	InstancePtr->SF3Spi.IsReady = TRUE;
+	InstancePtr->IntrVecId = (u8) IntcVecId;
+
+	return XST_SUCCESS;
+}
+
+XStatus SF3_FlashWriteEnable(PmodSF3* InstancePtr)
+{
+	MockN25q_WaitForReady();
+
+	pthread_mutex_lock(&mockN25qMutex);
+	mockN25q.writeEnabled = true;
+	pthread_mutex_unlock(&mockN25qMutex);
+
+	MockN25q_Transfer(InstancePtr, 1, 1);
+	return XST_SUCCESS;
+}
+
+XStatus SF3_BulkErase(PmodSF3* InstancePtr)
+{
+	MockN25q_WaitForReady();
+
+	pthread_mutex_lock(&mockN25qMutex);
+	if (mockN25q.writeEnabled) {
+		MockN25q_Erase(0, MOCK_N25Q_BYTE_COUNT, mockN25q.timing.dieEraseUs);
+	}
+	pthread_mutex_unlock(&mockN25qMutex);
+
+	MockN25q_Transfer(InstancePtr, 1, 1);
+	return XST_SUCCESS;
+}
+
+/* A program or erase without the write enable latch is ignored, as the N25Q does. */
+XStatus SF3_FlashWrite(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 WriteCmd, u8** BufferPtr)
+{
+	u8* Buffer = *BufferPtr;
+	const t_mock_n25q_frame frame = MockN25q_Frame(Addr, ByteCount, WriteCmd, Buffer);
+
+	MockN25q_WaitForReady();
+
+	pthread_mutex_lock(&mockN25qMutex);
+	if (mockN25q.writeEnabled) {
+		switch (WriteCmd) {
+		case SF3_COMMAND_PAGE_PROGRAM:
+		case MOCK_N25Q_COMMAND_PAGE_PROGRAM_4BYTE:
+		case MOCK_N25Q_COMMAND_QUAD_INPUT_PROGRAM:
+		case MOCK_N25Q_COMMAND_QUAD_INPUT_PROGRAM_4BYTE:
+			MockN25q_Program(frame.addr, &(Buffer[frame.headerBytes]), frame.dataBytes);
+			break;
+		case SF3_COMMAND_SECTOR_ERASE:
+		case MOCK_N25Q_COMMAND_SUBSECTOR_ERASE_4BYTE:
+			MockN25q_Erase(frame.addr, MOCK_N25Q_SUBSECTOR_SIZE, mockN25q.timing.subsectorEraseUs);
+			break;
+		case MOCK_N25Q_COMMAND_SECTOR_ERASE:
+		case MOCK_N25Q_COMMAND_SECTOR_ERASE_4BYTE:
+			MockN25q_Erase(frame.addr, MOCK_N25Q_SECTOR_SIZE, mockN25q.timing.sectorEraseUs);
+			break;
+		case MOCK_N25Q_COMMAND_DIE_ERASE:
+			MockN25q_Erase(0, MOCK_N25Q_BYTE_COUNT, mockN25q.timing.dieEraseUs);
+			break;
+		default:
+			break;
+		}
+	}
+	pthread_mutex_unlock(&mockN25qMutex);
+
+	Buffer[0] = WriteCmd;
+	Buffer[1] = (u8)(Addr >> 16);
+	Buffer[2] = (u8)(Addr >> 8);
+	Buffer[3] = (u8)(Addr);
+
+	MockN25q_Transfer(InstancePtr, frame.headerBytes + frame.dataBytes, 1);
+	return XST_SUCCESS;
+}
+
+/* The status and flag status registers are read repeatedly after the header,
+ * without waiting for ready; other reads wait for the N25Q to be ready. */
+XStatus SF3_FlashRead(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 ReadCmd, u8** BufferPtr)
+{
+	u8* Buffer = *BufferPtr;
+	t_mock_n25q_frame frame;
+	u8 regValue;
+
+	if ((ReadCmd == SF3_COMMAND_STATUSREG_READ) || (ReadCmd == MOCK_N25Q_COMMAND_READ_FLAG_STATUS_REG)) {
+		pthread_mutex_lock(&mockN25qMutex);
+		const bool busy = (MockN25q_NowNs() < mockN25q.busyUntilNs);
+
+		if (ReadCmd == SF3_COMMAND_STATUSREG_READ) {
+			regValue = (busy ? MOCK_N25Q_STATUS_WIP_MASK : 0x00) |
+					(mockN25q.writeEnabled ? MOCK_N25Q_STATUS_WEL_MASK : 0x00);
+		} else {
+			regValue = (busy ? 0x00 : MOCK_N25Q_FLAG_STATUS_READY_MASK) | mockN25q.flagErrors;
+		}
+		pthread_mutex_unlock(&mockN25qMutex);
+
+		memset(&(Buffer[SF3_READ_MIN_EXTRA_BYTES]), regValue, ByteCount);
+		MockN25q_Transfer(InstancePtr, SF3_READ_MIN_EXTRA_BYTES + ByteCount, 1);
+		return XST_SUCCESS;
+	}
+
+	frame = MockN25q_Frame(Addr, ByteCount, ReadCmd, Buffer);
+
+	MockN25q_WaitForReady();
+
+	pthread_mutex_lock(&mockN25qMutex);
+	for (u32 i = 0; i < frame.dataBytes; ++i) {
+		const u32 addr = (frame.addr + i) % MOCK_N25Q_BYTE_COUNT;
+		u8 value = mockN25q.memory[addr];
+
+		if ((mockN25q.stuckValid) && (addr == mockN25q.stuckAddr)) {
+			value &= ~(mockN25q.stuckMask);
+		}
+
+		Buffer[frame.headerBytes + i] = value;
+	}
+	pthread_mutex_unlock(&mockN25qMutex);
+
+	/* The bytes received during the header are those of an idle bus. */
+	memset(Buffer, 0xFF, frame.headerBytes);
+
+	MockN25q_Transfer(InstancePtr, frame.headerBytes + frame.dataBytes, frame.lanes);
+	return XST_SUCCESS;
+}
+
+/*------------------ Host harness control -------------------*/
+/*-----------------------------------------------------------*/
+void MockN25q_Reset(void)
+{
+	pthread_mutex_lock(&mockN25qMutex);
+	memset(mockN25q.memory, 0xFF, sizeof(mockN25q.memory));
+	mockN25q.writeEnabled = false;
+	mockN25q.flagErrors = 0x00;
+	mockN25q.busyUntilNs = 0;
+	mockN25q.stuckValid = false;
+	mockN25q.programErrValid = false;
+	mockN25q.eraseDelayValid = false;
+	pthread_mutex_unlock(&mockN25qMutex);
+}
+
+void MockN25q_SetTiming(const t_mock_n25q_timing* timing)
+{
+	pthread_mutex_lock(&mockN25qMutex);
+	mockN25q.timing = *timing;
+	pthread_mutex_unlock(&mockN25qMutex);
+}
+
+void MockN25q_InjectStuckLow(u32 addr, u8 stuckMask)
+{
+	pthread_mutex_lock(&mockN25qMutex);
+	mockN25q.stuckAddr = addr;
+	mockN25q.stuckMask = stuckMask;
+	mockN25q.stuckValid = true;
+	pthread_mutex_unlock(&mockN25qMutex);
+}
+
+void MockN25q_InjectProgramError(u32 addr)
+{
+	pthread_mutex_lock(&mockN25qMutex);
+	mockN25q.programErrAddr = addr;
+	mockN25q.programErrValid = true;
+	pthread_mutex_unlock(&mockN25qMutex);
+}
+
+void MockN25q_InjectEraseDelay(u32 addr, u32 delayUs)
+{
+	pthread_mutex_lock(&mockN25qMutex);
+	mockN25q.eraseDelayAddr = addr;
+	mockN25q.eraseDelayUs = delayUs;
+	mockN25q.eraseDelayValid = true;
+	pthread_mutex_unlock(&mockN25qMutex);
+}
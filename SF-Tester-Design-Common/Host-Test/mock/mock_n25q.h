@@ -0,0 +1,76 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file mock_n25q.h
+ *
+ * @brief
+ * Host harness control of the in-memory N25Q model behind the mock PmodSF3
+ * driver: the latencies of its commands and the faults injected into it.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef HOST_MOCK_MOCK_N25Q_H_
+#define HOST_MOCK_MOCK_N25Q_H_
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+/* The modeled N25Q, of a single die of 32 MiB like the N25Q256 of the PmodSF3 */
+#define MOCK_N25Q_BYTE_COUNT 33554432
+
+/* Latencies of the N25Q commands, in microseconds, and the SPI clock of the
+ * transfers; a clock of 0 transfers at once. All of them are divided by the
+ * time scale, so that a run of the host harness completes quickly. */
+typedef struct MOCK_N25Q_TIMING_TAG {
+	u32 pageProgramUs;
+	u32 subsectorEraseUs;
+	u32 sectorEraseUs;
+	u32 dieEraseUs;
+	u32 sckHz;
+	u32 timeScale;
+} t_mock_n25q_timing;
+
+/* The typical latencies of the N25Q256 datasheet, ten times faster. */
+#define MOCK_N25Q_TIMING_DEFAULT {500, 250000, 700000, 240000000, 0, 10}
+
+/* Erase the model, clear its status and its faults, and keep its timing. */
+void MockN25q_Reset(void);
+void MockN25q_SetTiming(const t_mock_n25q_timing* timing);
+
+/* Read the bits of the stuck mask of the byte at the address as 0. */
+void MockN25q_InjectStuckLow(u32 addr, u8 stuckMask);
+/* Fail the program of the page at the address with a flag status program error. */
+void MockN25q_InjectProgramError(u32 addr);
+/* Complete the erase of the address after the delay, which is not scaled. */
+void MockN25q_InjectEraseDelay(u32 addr, u32 delayUs);
+
+#endif /* HOST_MOCK_MOCK_N25Q_H_ */
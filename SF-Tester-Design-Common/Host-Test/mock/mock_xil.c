@@ -0,0 +1,123 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file mock_xil.c
+ *
+ * @brief
+ * Host mock of the Xilinx BSP and drivers used by the SF3 test engine other
+ * than the PmodSF3: the GPIO of the switches and buttons, the global timer,
+ * the standard output, and the AXI Quad SPI interrupt handler.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <time.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xgpio.h"
+#include "xil_printf.h"
+#include "xspi.h"
+#include "xtime_l.h"
+
+#define MOCK_GPIO_CHANNEL_COUNT 2
+
+static volatile u32 mockGpioInputs[MOCK_GPIO_CHANNEL_COUNT];
+
+/*------------------ GPIO -----------------------------------*/
+/*-----------------------------------------------------------*/
+int XGpio_Initialize(XGpio* InstancePtr, u16 DeviceId)
+{
+	InstancePtr->IsReady = TRUE;
+	return XST_SUCCESS;
+}
+
+int XGpio_SelfTest(XGpio* InstancePtr)
+{
+	return XST_SUCCESS;
+}
+
+void XGpio_SetDataDirection(XGpio* InstancePtr, unsigned Channel, u32 DirectionMask)
+{
+}
+
+u32 XGpio_DiscreteRead(XGpio* InstancePtr, unsigned Channel)
+{
+	return ((Channel >= 1) && (Channel <= MOCK_GPIO_CHANNEL_COUNT)) ? mockGpioInputs[Channel - 1] : 0;
+}
+
+void XGpio_InterruptEnable(XGpio* InstancePtr, u32 Mask)
+{
+}
+
+void XGpio_InterruptGlobalEnable(XGpio* InstancePtr)
+{
+}
+
+void XGpio_InterruptClear(XGpio* InstancePtr, u32 Mask)
+{
+}
+
+u32 XGpio_InterruptGetStatus(XGpio* InstancePtr)
+{
+	return 0;
+}
+
+void MockGpio_SetInputs(unsigned Channel, u32 Value)
+{
+	if ((Channel >= 1) && (Channel <= MOCK_GPIO_CHANNEL_COUNT)) {
+		mockGpioInputs[Channel - 1] = Value;
+	}
+}
+
+/*------------------ Global timer and standard output -------*/
+/*-----------------------------------------------------------*/
+void XTime_GetTime(XTime* Xtime_Global)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	*Xtime_Global = ((u64) ts.tv_sec * COUNTS_PER_SECOND) +
+			(((u64) ts.tv_nsec * COUNTS_PER_SECOND) / 1000000000ULL);
+}
+
+void outbyte(char c)
+{
+	putchar(c);
+}
+
+/*------------------ AXI Quad SPI ---------------------------*/
+/*-----------------------------------------------------------*/
+/* The mock PmodSF3 driver completes each transfer before raising its
+ * interrupt, so the driver handler has nothing left to do. */
+void XSpi_InterruptHandler(void* InstancePtr)
+{
+}
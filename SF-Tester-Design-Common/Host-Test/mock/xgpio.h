@@ -0,0 +1,66 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file xgpio.h
+ *
+ * @brief
+ * Host mock of the AXI GPIO driver of the switches and buttons, which
+ * reads the values set by the host harness.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef HOST_MOCK_XGPIO_H_
+#define HOST_MOCK_XGPIO_H_
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+#define XGPIO_IR_CH1_MASK 0x01
+#define XGPIO_IR_CH2_MASK 0x02
+
+typedef struct {
+	u32 IsReady;
+} XGpio;
+
+int XGpio_Initialize(XGpio* InstancePtr, u16 DeviceId);
+int XGpio_SelfTest(XGpio* InstancePtr);
+void XGpio_SetDataDirection(XGpio* InstancePtr, unsigned Channel, u32 DirectionMask);
+u32 XGpio_DiscreteRead(XGpio* InstancePtr, unsigned Channel);
+void XGpio_InterruptEnable(XGpio* InstancePtr, u32 Mask);
+void XGpio_InterruptGlobalEnable(XGpio* InstancePtr);
+void XGpio_InterruptClear(XGpio* InstancePtr, u32 Mask);
+u32 XGpio_InterruptGetStatus(XGpio* InstancePtr);
+
+/* Host harness only: set the value read from a channel. */
+void MockGpio_SetInputs(unsigned Channel, u32 Value);
+
+#endif /* HOST_MOCK_XGPIO_H_ */
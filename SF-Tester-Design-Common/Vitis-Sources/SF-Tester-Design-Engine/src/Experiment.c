@@ -0,0 +1,2331 @@
+/*------------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2020-2022 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file Experiment.c
+ *
+ * @brief A SoPC or AP SoC top-level design with the PMOD SF3 FreeRTOS driver.
+ * This design erases a group of subsectors, programs the subsectors, and then
+ * byte-compares the contents of the subsectors. The progress is displayed on
+ * a PMOD CLS 16x2 dot-matrix LCD and printed on a USB-UART display terminal.
+ * The board LEDs also display status, including progress, PASSED, and DONE.
+ *
+ * This test engine is the same for the MicroBlaze and Zynq applications; the
+ * PmodSF3 interrupts, the LED map and the buffer placement of each board are
+ * in its sf3_board.c.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2020-2022 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+/* Xilinx includes. */
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include "sleep.h"
+#include "xil_printf.h"
+#include "xil_cache.h"
+#include "xparameters.h"
+#include "xgpio.h"
+/* Project includes. */
+#include "PmodSF3.h"
+#include "PWM.h"
+#include "led_pwm.h"
+#include "sf3_n25q.h"
+#include "sf3_pattern.h"
+#include "sf3_timing.h"
+#include "sf3_log.h"
+#include "sf3_failmap.h"
+#include "sf3_wear.h"
+#include "sf3_board.h"
+#include "Experiment.h"
+
+extern QueueHandle_t xQueueLedConfig;
+extern QueueHandle_t xQueueClsDispl;
+extern QueueHandle_t xQueueSf3Xfer[SF3_DEVICE_COUNT];
+extern QueueHandle_t xQueueSf3XferDone[SF3_DEVICE_COUNT];
+
+/* SF3 experiment constants */
+#define USERIO_DEVICE_ID 0
+#define SWTCHS_SWS_MASK 0x0F
+#define BTNS_SWS_MASK 0x0F
+#define SWTCH_SW_CHANNEL 1
+#define BTNS_SW_CHANNEL 2
+#define SWTCH0_MASK 0x01
+#define SWTCH1_MASK 0x02
+#define SWTCH2_MASK 0x04
+#define SWTCH3_MASK 0x08
+#define BTN0_MASK 0x01
+#define BTN1_MASK 0x02
+#define BTN2_MASK 0x04
+#define BTN3_MASK 0x08
+/* Switch gestures of the setup mode and the retention check; the single
+ * switch values passed while raising them start no run, see
+ * Experiment_settleSwitches(). */
+#define SWTCHS_SETUP_MASK 0x0F
+#define SWTCHS_VERIFY_MASK 0x0C
+
+/* FIFO dummy bytes that N25Q_FlashRead() appends for the fast read commands,
+ * which are the N25Q default dummy clock cycles counted in bytes of the lane
+ * width of the AXI Quad SPI data phase. */
+#ifndef SF3_DUAL_READ_DUMMY_BYTES
+#define SF3_DUAL_READ_DUMMY_BYTES 2
+#endif
+#ifndef SF3_DUAL_IO_READ_DUMMY_BYTES
+#define SF3_DUAL_IO_READ_DUMMY_BYTES 2
+#endif
+#ifndef SF3_QUAD_READ_DUMMY_BYTES
+#define SF3_QUAD_READ_DUMMY_BYTES 4
+#endif
+#ifndef SF3_QUAD_IO_READ_DUMMY_BYTES
+#define SF3_QUAD_IO_READ_DUMMY_BYTES 5
+#endif
+#define SF3_READ_MAX_DUMMY_BYTES SF3_QUAD_IO_READ_DUMMY_BYTES
+
+/* The N25Q256 of the PmodSF3; define as 67108864 when built for an N25Q512.
+ * The 3-byte address commands reach only the first 16 MiB, beyond which they
+ * would alias the header subsector into the tested range, so that build
+ * tests the first 16 MiB, with the header subsector at its end. */
+#ifndef SF3_DEVICE_BYTE_COUNT
+#if N25Q_ADDR_4BYTE
+#define SF3_DEVICE_BYTE_COUNT 33554432
+#else
+#define SF3_DEVICE_BYTE_COUNT N25Q_ADDR_3BYTE_LIMIT
+#endif
+#endif
+
+#if (! N25Q_ADDR_4BYTE) && (SF3_DEVICE_BYTE_COUNT > N25Q_ADDR_3BYTE_LIMIT)
+#error "SF3_DEVICE_BYTE_COUNT exceeds the reach of the 3-byte address commands of N25Q_ADDR_4BYTE=0"
+#endif
+
+/* Bytes erased, programmed and verified per iteration of the sweep mode, a
+ * multiple of the subsector size. */
+#ifndef EXPERI_SWEEP_CHUNK_BYTES
+#define EXPERI_SWEEP_CHUNK_BYTES (SF3_DEVICE_BYTE_COUNT / 32)
+#endif
+
+/* Time budget of one FSM step of the program and read phases, after which
+ * the SF3 task blocks for a tick, so that the lower-priority print, CLS and
+ * LED tasks run, and services the display on its period before continuing.
+ * At least one tick is used when the budget is shorter than the tick period. */
+#ifndef EXPERI_STEP_BUDGET_MS
+#define EXPERI_STEP_BUDGET_MS 10
+#endif
+
+/* Time the switches and buttons must hold a new value before it is accepted,
+ * when an edge interrupt of the GPIO wakes the SF3 tasks rather than the
+ * 10 millisecond period sampling them. As the multi_input_debounce of the HDL
+ * designs, rounded up to one tick of the RTOS. */
+#ifndef SF3_INPUT_DEBOUNCE_MS
+#define SF3_INPUT_DEBOUNCE_MS 1
+#endif
+
+/* Time a single raised switch must hold, after all of the switches held down,
+ * before it starts the iterations of its pattern. Raising several switches for
+ * the setup mode or the retention check passes through single switch values
+ * held for less than this, which start nothing. */
+#ifndef SF3_SWITCH_START_SETTLE_MS
+#define SF3_SWITCH_START_SETTLE_MS 1000
+#endif
+
+/* SF3 state values and flags */
+static const uint8_t sf3_test_pattern_startval_a = 0x00;
+static const uint8_t sf3_test_pattern_incrval_a = 0x01;
+static const uint8_t sf3_test_pattern_startval_b = 0x08;
+static const uint8_t sf3_test_pattern_incrval_b = 0x07;
+static const uint8_t sf3_test_pattern_startval_c = 0x10;
+static const uint8_t sf3_test_pattern_incrval_c = 0x0F;
+static const uint8_t sf3_test_pattern_startval_d = 0x18;
+static const uint8_t sf3_test_pattern_incrval_d = 0x17;
+static const uint32_t max_possible_byte_count = SF3_DEVICE_BYTE_COUNT; // 256 Mbit or 512 Mbit
+static const uint32_t total_iteration_count = 32;
+static const uint32_t per_iteration_byte_count = max_possible_byte_count / total_iteration_count;
+static const uint32_t last_starting_byte_addr = per_iteration_byte_count * (total_iteration_count - 1);
+static const uint32_t sf3_subsector_addr_incr = 4096;
+static const uint32_t sf3_page_addr_incr = 256;
+static const uint32_t experi_sweep_chunk_byte_count = EXPERI_SWEEP_CHUNK_BYTES;
+static const uint32_t cnt_t_max = 100 * 3;
+
+/* The last subsector of the device holds the headers of the written runs, and
+ * is excluded from the tested range. Each header is appended to the next page
+ * of the subsector, which is erased only once all of its pages are used; the
+ * last valid header is that of the last written run. */
+static const uint32_t sf3_header_addr = SF3_DEVICE_BYTE_COUNT - N25Q_SUBSECTOR_SIZE;
+#define SF3_RUN_HEADER_MAGIC 0x48334653 /* "SF3H" */
+#define SF3_RUN_HEADER_ERASED 0xFFFFFFFF
+#define SF3_RUN_HEADER_SLOT_COUNT (N25Q_SUBSECTOR_SIZE / SF3_PAGE_SIZE)
+
+/* Header of the last written run, so that a read-only retention check can
+ * verify the same range against the same pattern without rewriting it. */
+typedef struct SF3_RUN_HEADER_TAG {
+	u32 magic;
+	u32 startAddr;
+	u32 byteCount;
+	u32 patternSelected;
+	u32 checkWord;
+} t_sf3_run_header;
+
+/* SF3 read engine command and data offset details */
+typedef struct SF3_READ_ENGINE_DESC_TAG {
+	u8 readCmd;
+	u8 dummyBytes;
+	char label[5];
+} t_sf3_read_engine;
+
+static const t_sf3_read_engine c_sf3_read_engines[SF3_READ_ENGINE_NONE] = {
+	{N25Q_READ_CMD, 0, "STD"},
+	{N25Q_DUAL_OUTPUT_READ_CMD, SF3_DUAL_READ_DUMMY_BYTES, "DOUT"},
+	{N25Q_DUAL_IO_READ_CMD, SF3_DUAL_IO_READ_DUMMY_BYTES, "DIO"},
+	{N25Q_QUAD_OUTPUT_READ_CMD, SF3_QUAD_READ_DUMMY_BYTES, "QOUT"},
+	{N25Q_QUAD_IO_READ_CMD, SF3_QUAD_IO_READ_DUMMY_BYTES, "QIO"}
+};
+
+/* SF3 erase command details, from the smallest granule to the largest, with
+ * the maximum erase time of the N25Q as the timeout of each erase. */
+typedef struct SF3_ERASE_DESC_TAG {
+	u32 byteCount;
+	u32 timeoutMs;
+	XStatus (*eraseFunc)(PmodSF3* InstancePtr, u32 Addr);
+} t_sf3_erase_granule;
+
+static const t_sf3_erase_granule c_sf3_erase_granules[SF3_ERASE_NONE] = {
+	{N25Q_SUBSECTOR_SIZE, 800, N25Q_SubsectorErase},
+	{N25Q_SECTOR_SIZE, 3000, N25Q_SectorErase},
+	{N25Q_DIE_SIZE, 480000, N25Q_DieErase},
+	{SF3_DEVICE_BYTE_COUNT, 480000, N25Q_BulkErase}
+};
+
+/* SF3 streaming read window details; each length divides the iteration. */
+typedef struct SF3_READ_WINDOW_DESC_TAG {
+	u32 byteCount;
+	char label[4];
+} t_sf3_read_window;
+
+static const t_sf3_read_window c_sf3_read_windows[SF3_READ_WINDOW_NONE] = {
+	{SF3_PAGE_SIZE, "256"},
+	{4096, "4K"},
+	{16384, "16K"},
+	{SF3_READ_WINDOW_MAX_BYTES, "64K"}
+};
+
+/* The transfer buffers of each device, aligned to the line of the data cache
+ * and kept apart from the FSM state of t_experiment_data so that the pattern
+ * compare kernel and the driver never share a cache line with the control
+ * fields. Ahead of each payload is room for the command, address and dummy
+ * bytes of the transfer, so that the payload itself starts on a cache line.
+ * The board selects the memory section of the buffers; a section of limited
+ * size is checked to fit the buffers of all of the devices. */
+#ifndef SF3_XFER_CACHE_LINE_BYTES
+#define SF3_XFER_CACHE_LINE_BYTES 32
+#endif
+#define SF3_XFER_HEADER_ROOM SF3_XFER_CACHE_LINE_BYTES
+#if (N25Q_READ_EXTRA_BYTES + SF3_READ_MAX_DUMMY_BYTES > SF3_XFER_HEADER_ROOM)
+#error "The transfer header room is too small for the command of a read."
+#endif
+#if defined(BOARD_XFER_BUFFER_MAX_BYTES)
+#define SF3_XFER_BUFFERS_BYTES (SF3_XFER_BUFFER_COUNT * \
+		(SF3_PAGE_SIZE + SF3_READ_WINDOW_MAX_BYTES + (2 * SF3_XFER_HEADER_ROOM)))
+#if (SF3_DEVICE_COUNT * SF3_XFER_BUFFERS_BYTES > BOARD_XFER_BUFFER_MAX_BYTES)
+#error "The transfer buffers of the SF3 devices do not fit the memory of their section."
+#endif
+#endif
+#define SF3_XFER_BUFFER_ATTRIBUTES __attribute__((aligned(SF3_XFER_CACHE_LINE_BYTES))) BOARD_XFER_BUFFER_SECTION
+
+/* Build with -DSF3_XFER_CACHE_MAINTENANCE=1 when a bus master other than the
+ * CPU moves the transfer buffers, to clean each buffer to memory before its
+ * transfer and discard the cached copy of a read buffer afterward. The
+ * PmodSF3 driver moves every byte through the CPU, so the default is none. */
+#ifndef SF3_XFER_CACHE_MAINTENANCE
+#define SF3_XFER_CACHE_MAINTENANCE 0
+#endif
+
+typedef struct SF3_XFER_BUFFERS_TAG {
+	u8 Write[SF3_XFER_BUFFER_COUNT][SF3_XFER_HEADER_ROOM + SF3_PAGE_SIZE];
+	u8 Read[SF3_XFER_BUFFER_COUNT][SF3_XFER_HEADER_ROOM + SF3_READ_WINDOW_MAX_BYTES];
+} t_sf3_xfer_buffers;
+
+typedef struct EXPERIMENT_DATA_TAG {
+	/* Driver objects */
+	XGpio axGpio;
+	PmodSF3* sf3Dev;
+	/* SF3 device index, also its log source, and its tag prefixing the text
+	 * lines it logs when testing more than one device */
+	int deviceIndex;
+	char devTag[4];
+	/* LED driver palettes stored */
+	t_rgb_led_palette_silk ledUpdate[BOARD_LED_SILK_COUNT];
+	/* Last LED states queued to the LED task, and the LEDs whose new state
+	 * differs from it and is still to be queued */
+	t_rgb_led_palette_silk ledShown[BOARD_LED_SILK_COUNT];
+	u8 ledDirtyMask;
+	/* Operating mode enumerations */
+	int operatingMode;
+	int operatingModePrev;
+	/* Selected testing address and pattern details */
+	bool sf3_start_at_zero;
+	uint32_t sf3_addr_start_val;// current starting address for multiple address of testing
+	int sf3_test_pattern_selected;
+	int sf3_test_pattern_bank; /* first test pattern of the bank the buttons select from */
+	int sf3_pattern_page_kind;
+	uint8_t sf3_pattern_start_val;
+	uint8_t sf3_pattern_incr_val;
+	int sf3_read_engine_selected;
+	int sf3_read_window_selected;
+	bool sf3_fast_mode;
+	bool sf3_sweep_mode;
+	bool sf3_test_pass;
+	bool sf3_test_done;
+	uint32_t sf3_err_count_val;
+	/* GPIO reading values at this point in the execution, accepted once
+	 * debounced, and the last raw values with the tick they last changed */
+	u32 switchesRead;
+	u32 buttonsRead;
+	u32 switchesRaw;
+	u32 buttonsRaw;
+	TickType_t inputs_change_tick;
+	bool inputs_pending;
+	/* Single switch starting the iterations of its pattern, or 0, accepted
+	 * once the switches settle after the tick they last changed; armed by
+	 * all of the switches settling down */
+	u32 switchStartRead;
+	TickType_t switches_change_tick;
+	bool switches_settle_pending;
+	bool switch_start_armed;
+	/* Timer count T for delay interval of the real-time task */
+	uint32_t cnt_t;
+	uint32_t cnt_t_freerun;
+	/* Tick at the start of the current FSM step, for the step time budget */
+	TickType_t step_start_tick;
+	/* Subsector and page counts of the current iteration, one button-started
+	 * iteration or one chunk of a sweep. */
+	u32 sf3_iter_subsector_cnt;
+	u32 sf3_iter_page_cnt;
+	/* Erased range of the current iteration: the tested range, or the whole
+	 * device for the first chunk of a sweep and nothing for its later chunks. */
+	u32 sf3_erase_start_val;
+	u32 sf3_erase_subsector_cnt;
+	/* Sweep of every chunk of the device, with the totals of all chunks. */
+	bool sf3_sweep_active;
+	uint32_t sf3_sweep_err_count_base;
+	/* Errors of the current iteration, and its first failing byte address and
+	 * bits, for the result stream. */
+	uint32_t sf3_iter_err_count_base;
+	u32 sf3_first_fail_addr;
+	u8 sf3_first_fail_xor;
+	bool sf3_first_fail_valid;
+	/* Failure map of the current iteration, or of the whole sweep. */
+	t_failmap failMap;
+	/* Erase counts and results of the regions tested since power-up, from
+	 * which the iterations started by a button pick their region. */
+	t_wear wear;
+	/* Read-only retention check of the run recorded in the header subsector,
+	 * with the position of the writing iterations to resume afterward. */
+	bool sf3_verify_selected;
+	bool sf3_verify_only;
+	u32 sf3_verify_start_val;
+	u32 sf3_verify_byte_count;
+	u32 sf3_verify_saved_addr;
+	bool sf3_verify_saved_at_zero;
+	t_timing_phase sweep_erase;
+	t_timing_phase sweep_program;
+	t_timing_phase sweep_read;
+	t_timing_phase sweep_read_1lane;
+	/* Iteration count I for counting subsectors and pages. */
+	u32 sf3_i_val;
+	u32 sf3_address_of_cmd;
+	/* Erase command in progress, from its write enable until the flag status
+	 * shows it complete, with its tick at the write enable and its latency
+	 * accumulated at each poll, as a die or bulk erase outlasts the wrap of
+	 * the timestamp counter. */
+	bool sf3_erase_pending;
+	int sf3_erase_granule;
+	u32 sf3_erase_stamp;
+	u64 sf3_erase_ticks;
+	TickType_t sf3_erase_start_tick;
+	/* An erase that outlasts its timeout ends the iteration once the N25Q is
+	 * ready again, or after a second timeout, and fails it without the
+	 * program and read phases; the count of such iterations since power-up
+	 * fails the test as the error count does. */
+	bool sf3_iter_aborted;
+	uint32_t sf3_abort_count;
+	/* Ping-pong pipeline tracking of pages issued to the transfer task. */
+	u32 sf3_i_issued;
+	int sf3_xfer_in_flight;
+	int sf3_xfer_fill_idx;
+	/* Per-phase throughput and command latency of the current iteration */
+	t_timing_phase timing_erase;
+	t_timing_phase timing_program;
+	t_timing_phase timing_read;
+	/* Read windows that N25Q_FlashRead() issued as the single lane read in
+	 * place of the selected dual or quad engine, timed by their transfers
+	 * and reported apart from the read phase. */
+	t_timing_phase timing_read_1lane;
+	bool timing_reported;
+	/* Write-enable completion latency since power-up, from the call of
+	 * SF3_FlashWriteEnable() armed by the transfer task to the entry of the
+	 * QSPI interrupt handler: the driver call setup and the shift of the
+	 * one byte, as well as the interrupt latency. */
+	volatile bool qspi_intr_armed;
+	u32 qspi_intr_stamp;
+	t_timing_stats qspi_intr_stats;
+	/* Page image of the selected test pattern, computed once per run, or the
+	 * expected contents of one page at a time for the page patterns */
+	u8 PageImage[SF3_PAGE_SIZE] __attribute__((aligned(32)));
+	/* Transmission buffers, one filling or comparing while the others transfer */
+	t_sf3_xfer_buffers* xferBuffers;
+} t_experiment_data;
+
+t_experiment_data experiData[SF3_DEVICE_COUNT]; // Global as that the object is always in scope, including interrupt handler.
+PmodSF3 sf3Device[SF3_DEVICE_COUNT];
+static t_sf3_xfer_buffers experiXferBuffers[SF3_DEVICE_COUNT] SF3_XFER_BUFFER_ATTRIBUTES;
+
+/* Subsector counters and masks of the failure map of each device, and the
+ * subsector erase counters of its wear record. The MicroBlaze designs execute
+ * from the MIG DDR, so these reside in DDR with the rest of the program data
+ * rather than in the local memory. */
+#define SF3_SUBSECTOR_COUNT (SF3_DEVICE_BYTE_COUNT / N25Q_SUBSECTOR_SIZE)
+static u16 experiFailMapErrCounts[SF3_DEVICE_COUNT][SF3_SUBSECTOR_COUNT];
+static u8 experiFailMapXorMasks[SF3_DEVICE_COUNT][SF3_SUBSECTOR_COUNT];
+static u16 experiWearEraseCounts[SF3_DEVICE_COUNT][SF3_SUBSECTOR_COUNT];
+
+/* Set by the device 0 task once the GPIO, LEDs and timestamp counter that
+ * all of the device tasks share are initialized. */
+static volatile bool experiSharedInitDone = false;
+
+/* SF3 tasks notified by the edge interrupt of the switch and button GPIO, if
+ * the design connects it; else the tasks sample the inputs every period. */
+static TaskHandle_t experiInputTasks[SF3_DEVICE_COUNT];
+static volatile bool experiInputIntrEnabled = false;
+
+/*------------------ Private Module Functions Prototypes ----*/
+static void Experiment_InitData(t_experiment_data* expData, int deviceIndex);
+static void Experiment_SetLedUpdate(t_experiment_data* expData,
+		uint8_t silk, uint8_t red, uint8_t green, uint8_t blue);
+static void Experiment_SendLedUpdate(t_experiment_data* expData, uint8_t silk);
+static void Experiment_updateLedsDisplayMode(t_experiment_data* expData);
+static void Experiment_updateLedsStatuses(t_experiment_data* expData);
+static void Experiment_updateClsDisplayAndTerminal(t_experiment_data* expData);
+static void Experiment_readUserInputs(t_experiment_data* expData);
+static void Experiment_settleSwitches(t_experiment_data* expData, TickType_t nowTick);
+static void Experiment_userInputsHandler(void* callbackRef);
+static bool Experiment_waitPeriodOrInput(t_experiment_data* expData,
+		TickType_t periodStartTime, TickType_t periodTicks);
+static void Experiment_operateFSM(t_experiment_data* expData);
+static void Experiment_iterationTimer(t_experiment_data* expData);
+static void Experiment_resetXferPipeline(t_experiment_data* expData);
+static u8* Experiment_writeXferBuffer(t_experiment_data* expData, int bufferIndex);
+static u8* Experiment_readXferBuffer(t_experiment_data* expData, int bufferIndex, u8 dummyBytes);
+static void Experiment_sendXfer(t_experiment_data* expData, t_sf3_xfer* xfer);
+static void Experiment_receiveXfer(t_experiment_data* expData, t_sf3_xfer* xfer);
+static bool Experiment_pollFlashReady(t_experiment_data* expData);
+static int Experiment_selectEraseGranule(u32 eraseAddr, u32 eraseByteCount);
+static void Experiment_recordErase(t_experiment_data* expData, u32 eraseAddr, u32 eraseByteCount);
+static void Experiment_generatePage(t_experiment_data* expData, u8* dst, u32 pageAddr);
+static bool Experiment_isActivePhase(t_experiment_data* expData);
+static bool Experiment_isErasePending(t_experiment_data* expData);
+static bool Experiment_isSetupStep(t_experiment_data* expData);
+static bool Experiment_isStepBudgetSpent(t_experiment_data* expData);
+static void Experiment_startSweep(t_experiment_data* expData);
+static uint32_t Experiment_totalErrCount(void);
+static bool Experiment_allDevicesPass(void);
+static bool Experiment_allDevicesDone(void);
+static void Experiment_reportSweep(t_experiment_data* expData);
+static void Experiment_reportPhaseTiming(t_experiment_data* expData, const char* label,
+		const t_timing_phase* phase);
+static void Experiment_engineReadTiming(t_timing_phase* engineRead, const t_timing_phase* read,
+		const t_timing_phase* read1Lane);
+static void Experiment_reportReadTiming(t_experiment_data* expData, const t_timing_phase* read,
+		const t_timing_phase* read1Lane);
+static void Experiment_logReport(t_experiment_data* expData, int eventId,
+		UINTPTR arg0, UINTPTR arg1, UINTPTR arg2, UINTPTR arg3);
+static void Experiment_reportIntrLatency(t_experiment_data* expData);
+static void Experiment_reportFailMap(t_experiment_data* expData);
+static void Experiment_reportWear(t_experiment_data* expData);
+static u32 Experiment_runHeaderCheck(const t_sf3_run_header* header);
+static bool Experiment_isRunHeaderValid(const t_sf3_run_header* header);
+static bool Experiment_scanRunHeaders(t_experiment_data* expData, t_sf3_run_header* header,
+		bool* headerFound, u32* freeSlot);
+static bool Experiment_waitFlashReady(t_experiment_data* expData);
+static void Experiment_writeRunHeader(t_experiment_data* expData, u32 startAddr, u32 byteCount);
+static bool Experiment_readRunHeader(t_experiment_data* expData, t_sf3_run_header* header);
+#if SF3_RESULT_STREAM
+static void Experiment_streamResult(t_experiment_data* expData);
+#endif
+#if SF3_RESULT_STREAM && SF3_KERNEL_BENCHMARK
+static void Experiment_benchmarkKernels(t_experiment_data* expData);
+#endif
+
+/*------------------ Global Module Functions ----------------*/
+/*-----------------------------------------------------------*/
+void Experiment_prvSf3Task( void *pvParameters )
+{
+	const TickType_t x10millisecond = pdMS_TO_TICKS( DELAY_1_SECOND / 100 );
+	//const TickType_t x05millisecond = pdMS_TO_TICKS( DELAY_1_SECOND / 200 );
+	TickType_t xPeriodStartTime;
+	bool bPeriodElapsed;
+	bool bInputEvent = false;
+	XStatus Status;
+	/* The task parameter is the index of the SF3 device this task tests. */
+	const int deviceIndex = (int)(UINTPTR) pvParameters;
+	t_experiment_data* expData = &(experiData[deviceIndex]);
+
+	experiInputTasks[deviceIndex] = xTaskGetCurrentTaskHandle();
+
+	/* Initialize the PMOD SF3 driver with the interrupt of this device. */
+	Status = Board_Sf3Begin(&(sf3Device[deviceIndex]), deviceIndex);
+
+	if (Status != XST_SUCCESS) {
+		Log_Event(deviceIndex, LOG_EVENT_SF3_FAIL, (UINTPTR) Status, 0, 0, 0);
+	}
+
+	/* Start the timestamp counter of the per-phase timing, once for all devices. */
+	if (deviceIndex == 0) {
+		Timing_Init();
+	} else {
+		while (! experiSharedInitDone) {
+			vTaskDelay( x10millisecond );
+		}
+	}
+
+	Experiment_InitData(expData, deviceIndex);
+
+#if SF3_RESULT_STREAM && SF3_KERNEL_BENCHMARK
+	/* The kernels are the same for every device, so they are timed once. */
+	if (deviceIndex == 0) {
+		Experiment_benchmarkKernels(expData);
+	}
+#endif
+
+	/* Initialize the GPIO device for inputting switches 0,1,2,3 and buttons 0,1,2,3.
+	 * This corresponds to the two channels set in the single AXI GPIO driver of
+	 * the FPGA system block design. */
+	taskENTER_CRITICAL();
+	XGpio_Initialize(&(expData->axGpio), USERIO_DEVICE_ID);
+	XGpio_SelfTest(&(expData->axGpio));
+	XGpio_SetDataDirection(&(expData->axGpio), SWTCH_SW_CHANNEL, SWTCHS_SWS_MASK);
+	XGpio_SetDataDirection(&(expData->axGpio), BTNS_SW_CHANNEL, BTNS_SWS_MASK);
+	taskEXIT_CRITICAL();
+
+	/* The device 0 task installs the edge interrupt of the inputs, which
+	 * notifies all of the SF3 tasks, on the designs that connect it. */
+	if (deviceIndex == 0) {
+		Status = Board_UserInputsBegin(&(expData->axGpio),
+				Experiment_userInputsHandler, &(expData->axGpio));
+		experiInputIntrEnabled = (Status == XST_SUCCESS);
+	}
+
+	/* Release the other device tasks; the LED task owns the LED PWMs and turns
+	 * all of the filaments off as it starts. */
+	if (deviceIndex == 0) {
+		experiSharedInitDone = true;
+	}
+
+	xPeriodStartTime = xTaskGetTickCount();
+
+	for (;;) {
+		/* The displays, holds and timer count on the 10 millisecond period,
+		 * while the active phases step as often as the budget allows. */
+		bPeriodElapsed = ((xTaskGetTickCount() - xPeriodStartTime) >= x10millisecond);
+
+		if (bPeriodElapsed) {
+			xPeriodStartTime = xTaskGetTickCount();
+		}
+
+		/* The device 0 task aggregates the displays of all of the devices. */
+		if ((bPeriodElapsed) && (deviceIndex == 0)) {
+			/* Update the color LEDs based on the current operating mode. */
+			Experiment_updateLedsDisplayMode(expData);
+
+			/* Update the basic LEDs based on current global statuses. */
+			Experiment_updateLedsStatuses(expData);
+
+			/* Update the Pmod CLS display based upon current state machine state and other variables */
+			Experiment_updateClsDisplayAndTerminal(expData);
+		}
+
+		if ((bPeriodElapsed) || (bInputEvent) || (Experiment_isActivePhase(expData)) ||
+				(Experiment_isSetupStep(expData))) {
+			/* Read the user inputs */
+			Experiment_readUserInputs(expData);
+
+			/* Operate a single step of the Experiment FSM, within the step time budget */
+			expData->step_start_tick = xTaskGetTickCount();
+			Experiment_operateFSM(expData);
+		}
+
+		if (bPeriodElapsed) {
+			/* State change timer, wrapping at 3 seconds. */
+			Experiment_iterationTimer(expData);
+		}
+
+		/* Block for a tick between the flag status polls of an erase, and
+		 * after a program or read step that spent its time budget, which
+		 * lets the lower-priority print, CLS, LED and idle tasks run while
+		 * the transfer task drains the buffers in flight. Yield after a step
+		 * that ended early at a phase change; continue at once through the
+		 * setup of an iteration; else block until the next period or input
+		 * edge. */
+		if ((Experiment_isErasePending(expData)) ||
+				((Experiment_isActivePhase(expData)) && (Experiment_isStepBudgetSpent(expData)))) {
+			bInputEvent = false;
+			vTaskDelay(1);
+		} else if (Experiment_isActivePhase(expData)) {
+			bInputEvent = false;
+			taskYIELD();
+		} else if (Experiment_isSetupStep(expData)) {
+			bInputEvent = false;
+		} else {
+			bInputEvent = Experiment_waitPeriodOrInput(expData, xPeriodStartTime, x10millisecond);
+		}
+	}
+}
+
+/*-----------------------------------------------------------*/
+/* The SF3 transfer task performs the page program and read transfers queued
+ * by the SF3 task. While this task blocks on the interrupt-driven completion
+ * of a transfer, the SF3 task generates or compares another buffer.
+ */
+void Experiment_prvSf3XferTask( void *pvParameters )
+{
+	/* The task parameter is the index of the SF3 device this task transfers with. */
+	const int deviceIndex = (int)(UINTPTR) pvParameters;
+	PmodSF3* sf3Dev = &(sf3Device[deviceIndex]);
+	t_experiment_data* expData = &(experiData[deviceIndex]);
+	t_sf3_xfer xfer;
+	u8* BufferPtr;
+	u32 stamp;
+#if SF3_XFER_CACHE_MAINTENANCE
+	u32 xferByteCount;
+#endif
+
+	for (;;) {
+		/* Block on the request queue to receive the next transfer. */
+		xQueueReceive(xQueueSf3Xfer[deviceIndex], &xfer, portMAX_DELAY);
+		BufferPtr = xfer.buffer;
+
+#if SF3_XFER_CACHE_MAINTENANCE
+		if (xfer.xferType == SF3_XFER_PROGRAM)
+			xferByteCount = N25Q_WRITE_EXTRA_BYTES + xfer.byteCount;
+		else
+			xferByteCount = N25Q_READ_EXTRA_BYTES + xfer.dummyBytes + xfer.byteCount;
+
+		Xil_DCacheFlushRange((INTPTR) xfer.buffer, xferByteCount);
+#endif
+
+		if (xfer.xferType == SF3_XFER_PROGRAM) {
+			/* The stamp is taken before the driver call, as the driver starts
+			 * the transfer internally, so the latency recorded at the interrupt
+			 * includes the call setup and the shift of the one byte. */
+			expData->qspi_intr_stamp = Timing_Now();
+			expData->qspi_intr_armed = true;
+			xfer.statusWen = SF3_FlashWriteEnable(sf3Dev);
+			expData->qspi_intr_armed = false;
+			stamp = Timing_Now();
+			xfer.status = N25Q_FlashWrite(sf3Dev, xfer.address, xfer.byteCount, xfer.command, &(BufferPtr));
+		} else {
+			xfer.statusWen = XST_SUCCESS;
+			stamp = Timing_Now();
+			xfer.status = N25Q_FlashRead(sf3Dev, xfer.address, xfer.byteCount, xfer.command,
+					xfer.dummyBytes, &(BufferPtr));
+		}
+
+		xfer.latencyTicks = Timing_Now() - stamp;
+
+#if SF3_XFER_CACHE_MAINTENANCE
+		if (xfer.xferType == SF3_XFER_READ)
+			Xil_DCacheInvalidateRange((INTPTR) xfer.buffer, xferByteCount);
+#endif
+
+		/* Return the buffer to the SF3 task. */
+		xQueueSend(xQueueSf3XferDone[deviceIndex], &xfer, portMAX_DELAY);
+	}
+}
+
+/*-----------------------------------------------------------*/
+/* Return the failure map of the last iteration or sweep of an SF3 device,
+ * complete once the device task reaches ST_DISPLAY_FINAL.
+ */
+const t_failmap* Experiment_GetFailMap(int deviceIndex) {
+	return &(experiData[deviceIndex].failMap);
+}
+
+/*-----------------------------------------------------------*/
+/* Handler of the QSPI interrupt of an SF3 device, which the board installs in
+ * place of the handler of the PmodSF3 driver, with the device index as its
+ * callback reference. The first entry after an armed write enable records
+ * its completion latency, and the driver handler then runs as before.
+ */
+void Experiment_Sf3IntrHandler(void* callbackRef) {
+	const int deviceIndex = (int)(UINTPTR) callbackRef;
+	t_experiment_data* expData = &(experiData[deviceIndex]);
+
+	if (expData->qspi_intr_armed) {
+		expData->qspi_intr_armed = false;
+		Timing_RecordLatency(&(expData->qspi_intr_stats), Timing_Now() - expData->qspi_intr_stamp);
+	}
+
+	XSpi_InterruptHandler(&(sf3Device[deviceIndex].SF3Spi));
+}
+
+/*------------------ Private Module Functions ----------------*/
+/*-----------------------------------------------------------*/
+/* Helper function to initialize the state of the \ref t_experiment_data object
+ * belonging to this module's real-time task.
+ */
+static void Experiment_InitData(t_experiment_data* expData, int deviceIndex) {
+	for (int iLed = 0; iLed < BOARD_RGB_LED_COUNT; ++iLed) {
+		Experiment_SetLedUpdate(expData, c_board_rgb_led_silks[iLed], 0x00, 0x00, 0x00);
+	}
+	for (int iLed = 0; iLed < BOARD_STATUS_LED_COUNT; ++iLed) {
+		Experiment_SetLedUpdate(expData, c_board_status_led_silks[iLed], 0x00, 0x00, 0x00);
+	}
+
+	expData->sf3Dev = &(sf3Device[deviceIndex]);
+	expData->deviceIndex = deviceIndex;
+	expData->xferBuffers = &(experiXferBuffers[deviceIndex]);
+	if (SF3_DEVICE_COUNT > 1)
+		snprintf(expData->devTag, sizeof(expData->devTag), "%d ", deviceIndex);
+	else
+		expData->devTag[0] = '\0';
+
+	FailMap_Init(&(expData->failMap), experiFailMapErrCounts[deviceIndex],
+			experiFailMapXorMasks[deviceIndex], SF3_SUBSECTOR_COUNT);
+	Wear_Init(&(expData->wear), experiWearEraseCounts[deviceIndex], SF3_SUBSECTOR_COUNT,
+			per_iteration_byte_count, total_iteration_count);
+
+	expData->operatingMode = ST_WAIT_BUTTON_DEP;
+	expData->operatingModePrev = ST_WAIT_BUTTON_DEP;
+	expData->sf3_start_at_zero = true;
+	expData->sf3_addr_start_val = 0x00000000;
+	expData->sf3_test_pattern_selected = TEST_PATTERN_NONE;
+	expData->sf3_test_pattern_bank = TEST_PATTERN_A;
+	expData->sf3_pattern_page_kind = PATTERN_PAGE_NONE;
+	expData->sf3_pattern_start_val = sf3_test_pattern_startval_a;
+	expData->sf3_pattern_incr_val = sf3_test_pattern_incrval_a;
+	expData->sf3_read_engine_selected = SF3_READ_ENGINE_DEFAULT;
+	expData->sf3_read_window_selected = SF3_READ_WINDOW_DEFAULT;
+	expData->sf3_fast_mode = SF3_FAST_MODE_DEFAULT;
+	expData->sf3_sweep_mode = SF3_SWEEP_MODE_DEFAULT;
+	expData->sf3_test_pass = false;
+	expData->sf3_test_done = false;
+	expData->sf3_err_count_val = 0;
+	expData->switchesRead = 0x00000000;
+	expData->buttonsRead = 0x00000000;
+	expData->switchesRaw = 0x00000000;
+	expData->buttonsRaw = 0x00000000;
+	expData->inputs_change_tick = xTaskGetTickCount();
+	expData->inputs_pending = false;
+	expData->switchStartRead = 0x00000000;
+	expData->switches_change_tick = xTaskGetTickCount();
+	expData->switches_settle_pending = true;
+	expData->switch_start_armed = false;
+	expData->cnt_t = 0;
+	expData->cnt_t_freerun = 0;
+	expData->step_start_tick = 0;
+	Timing_PhaseStart(&(expData->timing_erase));
+	Timing_PhaseStart(&(expData->timing_program));
+	Timing_PhaseStart(&(expData->timing_read));
+	Timing_PhaseStart(&(expData->timing_read_1lane));
+	expData->timing_reported = true;
+	expData->qspi_intr_armed = false;
+	Timing_ResetStats(&(expData->qspi_intr_stats));
+	expData->sf3_iter_subsector_cnt = per_iteration_byte_count / sf3_subsector_addr_incr;
+	expData->sf3_iter_page_cnt = per_iteration_byte_count / sf3_page_addr_incr;
+	expData->sf3_erase_start_val = 0x00000000;
+	expData->sf3_erase_subsector_cnt = expData->sf3_iter_subsector_cnt;
+	expData->sf3_sweep_active = false;
+	expData->sf3_sweep_err_count_base = 0;
+	expData->sf3_erase_pending = false;
+	expData->sf3_iter_aborted = false;
+	expData->sf3_abort_count = 0;
+	expData->sf3_verify_selected = false;
+	expData->sf3_verify_only = false;
+}
+
+/* Helper function to set an updated state to one of the LEDs of the board. */
+static void Experiment_SetLedUpdate(t_experiment_data* expData,
+		uint8_t silk, uint8_t red, uint8_t green, uint8_t blue)
+{
+	if (silk < BOARD_LED_SILK_COUNT) {
+		expData->ledUpdate[silk].ledSilk = silk;
+		expData->ledUpdate[silk].rgb.paletteRed = red;
+		expData->ledUpdate[silk].rgb.paletteGreen = green;
+		expData->ledUpdate[silk].rgb.paletteBlue = blue;
+
+		if (memcmp(&(expData->ledUpdate[silk].rgb), &(expData->ledShown[silk].rgb),
+				sizeof(t_rgb_led_palette)) != 0) {
+			expData->ledDirtyMask |= (1U << silk);
+		} else {
+			expData->ledDirtyMask &= ~(1U << silk);
+		}
+	}
+}
+
+
+/* Helper function to send via queue a request for LED state update, only when
+ * the LED state changed. A full queue leaves the LED marked to send again on
+ * the next update. */
+static void Experiment_SendLedUpdate(t_experiment_data* expData,
+		uint8_t silk)
+{
+	if ((silk < BOARD_LED_SILK_COUNT) && (expData->ledDirtyMask & (1U << silk))) {
+		if (xQueueSend( xQueueLedConfig, &(expData->ledUpdate[silk]), 0UL) == pdPASS) {
+			expData->ledShown[silk] = expData->ledUpdate[silk];
+			expData->ledDirtyMask &= ~(1U << silk);
+		}
+	}
+}
+
+/* Helper function for displaying the status LEDs based on event count
+ * and holding the LED display for a set interval of time.
+ */
+static void Experiment_updateLedsStatuses(t_experiment_data* expData) {
+	/* Set the status LEDs to track test passing and test done. */
+	Experiment_SetLedUpdate(expData, c_board_status_led_silks[BOARD_STATUS_LED_PASS],
+			0, (Experiment_allDevicesPass() ? 100 : 0), 0);
+	Experiment_SetLedUpdate(expData, c_board_status_led_silks[BOARD_STATUS_LED_DONE],
+			0, (Experiment_allDevicesDone() ? 100 : 0), 0);
+
+	for (int iLed = BOARD_STATUS_LED_DONE + 1; iLed < BOARD_STATUS_LED_COUNT; ++iLed) {
+		Experiment_SetLedUpdate(expData, c_board_status_led_silks[iLed], 0, 0, 0);
+	}
+
+	for (int iLed = 0; iLed < BOARD_STATUS_LED_COUNT; ++iLed) {
+		Experiment_SendLedUpdate(expData, c_board_status_led_silks[iLed]);
+	}
+}
+
+/* Helper function for displaying Color LEDs based on Operating Mode state machine value. */
+static void Experiment_updateLedsDisplayMode(t_experiment_data* expData)
+{
+	const t_board_rgb_led_lit* ledLit = NULL;
+	int iPattern;
+
+	switch (expData->operatingMode) {
+	case ST_WAIT_BUTTON_REL: /* no break */ case ST_SET_PATTERN: /* no break */ case ST_SET_START_ADDR: /* no break */ case ST_SET_START_WAIT:
+		iPattern = expData->sf3_test_pattern_selected - TEST_PATTERN_A;
+		if ((iPattern >= 0) && (iPattern < BOARD_PATTERN_LED_COUNT))
+			ledLit = &(c_board_pattern_leds[iPattern]);
+		break;
+
+	case ST_CMD_ERASE_START:
+		ledLit = &(c_board_step_leds[BOARD_LED_STEP_ERASE_START]);
+		break;
+
+	case ST_CMD_ERASE_DONE:
+		ledLit = &(c_board_step_leds[BOARD_LED_STEP_ERASE_DONE]);
+		break;
+
+	case ST_CMD_PAGE_START:
+		ledLit = &(c_board_step_leds[BOARD_LED_STEP_PAGE_START]);
+		break;
+
+	case ST_CMD_PAGE_DONE:
+		ledLit = &(c_board_step_leds[BOARD_LED_STEP_PAGE_DONE]);
+		break;
+
+	case ST_CMD_READ_START:
+		ledLit = &(c_board_step_leds[BOARD_LED_STEP_READ_START]);
+		break;
+
+	case ST_CMD_READ_DONE:
+		ledLit = &(c_board_step_leds[BOARD_LED_STEP_READ_DONE]);
+		break;
+
+	case ST_DISPLAY_FINAL:
+		ledLit = &(c_board_step_leds[BOARD_LED_STEP_FINAL]);
+		break;
+
+	case ST_WAIT_BUTTON_DEP:
+		/* no break */
+	default: /* OPERATING_MODE_NONE */
+		/* LED pattern to indicate running operating mode: waiting for button depress. */
+		for (int iLed = 0; iLed < BOARD_RGB_LED_COUNT; ++iLed) {
+			Experiment_SetLedUpdate(expData, c_board_rgb_led_silks[iLed], 0xFF, 0, 0);
+		}
+		break;
+	}
+
+	/* A pattern or step lights one of the RGB LEDs and turns off the others. */
+	if (ledLit != NULL) {
+		for (int iLed = 0; iLed < BOARD_RGB_LED_COUNT; ++iLed) {
+			if (iLed == ledLit->rgbIndex) {
+				Experiment_SetLedUpdate(expData, c_board_rgb_led_silks[iLed],
+						ledLit->rgb.paletteRed, ledLit->rgb.paletteGreen, ledLit->rgb.paletteBlue);
+			} else {
+				Experiment_SetLedUpdate(expData, c_board_rgb_led_silks[iLed], 0, 0, 0);
+			}
+		}
+	}
+
+	for (int iLed = 0; iLed < BOARD_RGB_LED_COUNT; ++iLed) {
+		Experiment_SendLedUpdate(expData, c_board_rgb_led_silks[iLed]);
+	}
+}
+
+/* Helper function to generate the first text line for updating Pmod CLS. */
+static void Experiment_generateTextLine1(t_experiment_data* expData, t_cls_lines* clsUpdate)
+{
+	static char cls_txt_ascii_pattern_1char = '*';
+
+	/* In setup mode, Line 1 is a fixed title. */
+	if ((expData->operatingMode == ST_SETUP_OPTIONS) ||
+			(expData->operatingMode == ST_SETUP_BUTTON_REL)) {
+		snprintf(clsUpdate->line1, sizeof(clsUpdate->line1), "SF3 SETUP");
+		return;
+	}
+
+	/* Select the character to display to indicate test pattern on Pmod CLS. */
+	switch (expData->sf3_test_pattern_selected) {
+	case TEST_PATTERN_A:
+		cls_txt_ascii_pattern_1char = 'A';
+		break;
+	case TEST_PATTERN_B:
+		cls_txt_ascii_pattern_1char = 'B';
+		break;
+	case TEST_PATTERN_C:
+		cls_txt_ascii_pattern_1char = 'C';
+		break;
+	case TEST_PATTERN_D:
+		cls_txt_ascii_pattern_1char = 'D';
+		break;
+	case TEST_PATTERN_E:
+		cls_txt_ascii_pattern_1char = 'E';
+		break;
+	case TEST_PATTERN_F:
+		cls_txt_ascii_pattern_1char = 'F';
+		break;
+	case TEST_PATTERN_G:
+		cls_txt_ascii_pattern_1char = 'G';
+		break;
+	case TEST_PATTERN_H:
+		cls_txt_ascii_pattern_1char = 'H';
+		break;
+	default:
+		cls_txt_ascii_pattern_1char = '*';
+		break;
+	}
+
+	/* Generate the string of Line 1 for updating the Pmod CLS */
+	snprintf(clsUpdate->line1, sizeof(clsUpdate->line1),
+			"SF3 %c%c h%08lx", (expData->sf3_verify_only) ? 'R' : 'P',
+			cls_txt_ascii_pattern_1char,
+			(unsigned long) expData->sf3_addr_start_val);
+}
+
+/* Helper function to generate the second text line for updating Pmod CLS. */
+static void Experiment_generateTextLine2(t_experiment_data* expData, t_cls_lines* clsUpdate)
+{
+	char cls_txt_ascii_sf3mode_3char[4] = "***";
+
+	/* In setup mode, Line 2 displays the selected options. */
+	if ((expData->operatingMode == ST_SETUP_OPTIONS) ||
+			(expData->operatingMode == ST_SETUP_BUTTON_REL)) {
+		snprintf(clsUpdate->line2, sizeof(clsUpdate->line2),
+				"%-4s %-3s F%dS%d P%c", c_sf3_read_engines[expData->sf3_read_engine_selected].label,
+				c_sf3_read_windows[expData->sf3_read_window_selected].label,
+				expData->sf3_fast_mode ? 1 : 0, expData->sf3_sweep_mode ? 1 : 0,
+				'A' + expData->sf3_test_pattern_bank);
+		return;
+	}
+
+	/* Select the three-character value to display to indicate
+	 * simplified operating mode on the Pmod CLS as part of
+	 * Line 2.
+	 */
+	switch (expData->operatingMode) {
+	case ST_WAIT_BUTTON_REL: /* no break */ case ST_SET_PATTERN: /* no break */
+	case ST_SET_START_ADDR: /* no break */ case ST_SET_START_WAIT:
+		strcpy(cls_txt_ascii_sf3mode_3char, "GO ");
+		break;
+
+	case ST_CMD_ERASE_START: /* no break */ case ST_CMD_ERASE_DONE:
+		strcpy(cls_txt_ascii_sf3mode_3char, "ERS");
+		break;
+
+	case ST_CMD_PAGE_START: /* no break */	case ST_CMD_PAGE_DONE:
+		strcpy(cls_txt_ascii_sf3mode_3char, "PRO");
+		break;
+
+	case ST_CMD_READ_START: /* no break */ case ST_CMD_READ_DONE:
+		strcpy(cls_txt_ascii_sf3mode_3char, "TST");
+		break;
+
+	case ST_DISPLAY_FINAL:
+		strcpy(cls_txt_ascii_sf3mode_3char, "END");
+		break;
+
+	case ST_WAIT_BUTTON_DEP: /* no break */
+	default:
+		strcpy(cls_txt_ascii_sf3mode_3char, "GO ");
+		break;
+	}
+
+	/* Generate the string of Line 2 for updating the Pmod CLS */
+	snprintf(clsUpdate->line2, sizeof(clsUpdate->line2),
+			"%s ERR %08ld", cls_txt_ascii_sf3mode_3char,
+			(long) Experiment_totalErrCount());
+}
+
+/* Helper function for displaying SF3 state machine progress on Pmod CLS */
+static void Experiment_updateClsDisplayAndTerminal(t_experiment_data* expData) {
+	static t_cls_lines clsUpdate;
+	t_log_record* record;
+
+	/* Only refresh display at approximately 5 Hz */
+	if (expData->cnt_t_freerun % (cnt_t_max / 15) != 0) {
+		return;
+	}
+
+	Experiment_generateTextLine1(expData, &clsUpdate);
+	Experiment_generateTextLine2(expData, &clsUpdate);
+
+	/* Update the display to two lines of custom text to indicate
+	 * SF3 Testing Progress
+	 */
+	xQueueSend(xQueueClsDispl, &clsUpdate, 0UL);
+
+	/* Update the Terminal to display an additional text line with the same
+	 * information as the Pmod CLS, formatted in place in the log record. */
+	record = Log_Reserve(expData->deviceIndex, 0);
+	if (record != NULL) {
+		record->eventId = LOG_EVENT_TEXT;
+		snprintf(record->text, sizeof(record->text), "%s %s", clsUpdate.line1, clsUpdate.line2);
+		Log_Commit(expData->deviceIndex);
+	}
+}
+
+/* Helper function to read user inputs at this time. When the edge interrupt
+ * wakes the task, a new value is accepted once it has held for the debounce
+ * time; the 10 millisecond sampling otherwise accepts every value read. */
+static void Experiment_readUserInputs(t_experiment_data* expData) {
+	const u32 switchesRaw = XGpio_DiscreteRead(&(expData->axGpio), SWTCH_SW_CHANNEL);
+	const u32 buttonsRaw = XGpio_DiscreteRead(&(expData->axGpio), BTNS_SW_CHANNEL);
+	const TickType_t nowTick = xTaskGetTickCount();
+	TickType_t debounceTicks = pdMS_TO_TICKS(SF3_INPUT_DEBOUNCE_MS);
+
+	if (debounceTicks == 0)
+		debounceTicks = 1;
+
+	if ((switchesRaw != expData->switchesRaw) || (buttonsRaw != expData->buttonsRaw)) {
+		expData->switchesRaw = switchesRaw;
+		expData->buttonsRaw = buttonsRaw;
+		expData->inputs_change_tick = nowTick;
+	}
+
+	if ((! experiInputIntrEnabled) ||
+			((nowTick - expData->inputs_change_tick) >= debounceTicks)) {
+		if (switchesRaw != expData->switchesRead)
+			expData->switches_change_tick = nowTick;
+		expData->switchesRead = switchesRaw;
+		expData->buttonsRead = buttonsRaw;
+	}
+
+	expData->inputs_pending = ((expData->switchesRead != switchesRaw) ||
+			(expData->buttonsRead != buttonsRaw));
+
+	Experiment_settleSwitches(expData, nowTick);
+
+	/* Switches 2 and 3 raised together select the read-only retention check. */
+	expData->sf3_verify_selected = (expData->switchesRead == SWTCHS_VERIFY_MASK);
+}
+
+/* Helper function to accept a single raised switch as the start of the
+ * iterations of its pattern, once the switches have held it for the settle
+ * time after all of them settled down. The start stays accepted while the
+ * switch stays raised, so that the iterations continue. A gesture raising
+ * several switches does not settle on its intermediate values, and once it
+ * settles, lowering its switches does not start a run until all are down. */
+static void Experiment_settleSwitches(t_experiment_data* expData, TickType_t nowTick) {
+	const u32 switches = expData->switchesRead;
+	const bool singleSwitch = ((switches != 0) && ((switches & (switches - 1)) == 0));
+	TickType_t settleTicks = pdMS_TO_TICKS(SF3_SWITCH_START_SETTLE_MS);
+
+	if (settleTicks == 0)
+		settleTicks = 1;
+
+	expData->switches_settle_pending = ((nowTick - expData->switches_change_tick) < settleTicks);
+
+	if (expData->switches_settle_pending) {
+		expData->switchStartRead = 0x00000000;
+	} else if (switches == 0x00000000) {
+		expData->switch_start_armed = true;
+		expData->switchStartRead = 0x00000000;
+	} else if ((singleSwitch) && (expData->switch_start_armed)) {
+		expData->switchStartRead = switches;
+	} else {
+		expData->switch_start_armed = false;
+		expData->switchStartRead = 0x00000000;
+	}
+}
+
+/* Interrupt handler of an edge of the switches or buttons, notifying each of
+ * the SF3 tasks to read and debounce the inputs now. */
+static void Experiment_userInputsHandler(void* callbackRef) {
+	XGpio* gpioPtr = (XGpio*) callbackRef;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	XGpio_InterruptClear(gpioPtr, XGpio_InterruptGetStatus(gpioPtr));
+
+	for (int iDev = 0; iDev < SF3_DEVICE_COUNT; ++iDev) {
+		if (experiInputTasks[iDev] != NULL) {
+			vTaskNotifyGiveFromISR(experiInputTasks[iDev], &xHigherPriorityTaskWoken);
+		}
+	}
+
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/* Helper function to block the SF3 task until its next period, returning true
+ * if it is woken earlier to read the inputs. A new input value still being
+ * debounced wakes the task once it has held; the tasks other than device 0,
+ * which refresh no display, wait for a button without a period at all, once
+ * the switches have settled. */
+static bool Experiment_waitPeriodOrInput(t_experiment_data* expData,
+		TickType_t periodStartTime, TickType_t periodTicks) {
+	const TickType_t elapsedTicks = xTaskGetTickCount() - periodStartTime;
+	TickType_t waitTicks = (elapsedTicks < periodTicks) ? (periodTicks - elapsedTicks) : 0;
+	TickType_t debounceTicks = pdMS_TO_TICKS(SF3_INPUT_DEBOUNCE_MS);
+
+	if (! experiInputIntrEnabled) {
+		vTaskDelayUntil( &periodStartTime, periodTicks );
+		return false;
+	}
+
+	if (debounceTicks == 0)
+		debounceTicks = 1;
+
+	if (expData->inputs_pending) {
+		if (waitTicks > debounceTicks)
+			waitTicks = debounceTicks;
+		ulTaskNotifyTake(pdTRUE, waitTicks);
+		return true;
+	}
+
+	/* A count T of zero has not yet stepped a period in this mode. */
+	if ((expData->deviceIndex != 0) && (expData->operatingMode == ST_WAIT_BUTTON_DEP) &&
+			(expData->operatingModePrev == ST_WAIT_BUTTON_DEP) && (expData->cnt_t > 0) &&
+			(! expData->switches_settle_pending)) {
+		waitTicks = portMAX_DELAY;
+	}
+
+	return (ulTaskNotifyTake(pdTRUE, waitTicks) > 0);
+}
+
+/* Main FSM function to operate the modes of the experiment. */
+static void Experiment_operateFSM(t_experiment_data* expData) {
+	u8* WriteBufferPtr;
+	u8* ReadBufferPtr;
+	u8* ReadPayloadPtr;
+	u32 readByteCount;
+	u32 pageErrCount;
+	int eraseGranule;
+	t_sf3_xfer xfer;
+	u32 stamp;
+	TickType_t eraseElapsed;
+	u32 iterByteCount = per_iteration_byte_count;
+
+	const t_sf3_read_engine* readEngine = &(c_sf3_read_engines[expData->sf3_read_engine_selected]);
+	const t_sf3_read_window* readWindow = &(c_sf3_read_windows[expData->sf3_read_window_selected]);
+	XStatus Status = 0;
+
+	switch(expData->operatingMode) {
+	case ST_WAIT_BUTTON_DEP:
+		if (expData->switchesRead == SWTCHS_SETUP_MASK) {
+			/* All four switches raised enters setup mode. */
+			expData->operatingMode = ST_SETUP_OPTIONS;
+		} else if (expData->sf3_verify_selected) {
+			/* Any button starts a retention check of the last written run. */
+			if (expData->buttonsRead != 0x00000000) {
+				expData->sf3_verify_only = true;
+				expData->sf3_test_done = false;
+				expData->operatingMode = ST_WAIT_BUTTON_REL;
+			}
+		} else if ((expData->sf3_sweep_mode) || (SF3_WEAR_SCHEDULE) ||
+				(expData->sf3_addr_start_val < last_starting_byte_addr)) {
+			/* The scheduled iterations continue once every region is covered. */
+			expData->sf3_test_done = (SF3_WEAR_SCHEDULE) && (! expData->sf3_sweep_mode) &&
+					(Wear_IsCovered(&(expData->wear)));
+
+			if ((expData->buttonsRead == BTN0_MASK) || (expData->switchStartRead == SWTCH0_MASK)) {
+				expData->operatingMode = ST_WAIT_BUTTON_REL;
+				expData->sf3_test_pattern_selected = expData->sf3_test_pattern_bank + 0;
+
+			} else if ((expData->buttonsRead == BTN1_MASK) || (expData->switchStartRead == SWTCH1_MASK)) {
+				expData->operatingMode = ST_WAIT_BUTTON_REL;
+				expData->sf3_test_pattern_selected = expData->sf3_test_pattern_bank + 1;
+
+			} else if ((expData->buttonsRead == BTN2_MASK) || (expData->switchStartRead == SWTCH2_MASK)) {
+				expData->operatingMode = ST_WAIT_BUTTON_REL;
+				expData->sf3_test_pattern_selected = expData->sf3_test_pattern_bank + 2;
+
+			} else if ((expData->buttonsRead == BTN3_MASK) || (expData->switchStartRead == SWTCH3_MASK)) {
+				expData->operatingMode = ST_WAIT_BUTTON_REL;
+				expData->sf3_test_pattern_selected = expData->sf3_test_pattern_bank + 3;
+			}
+
+			if ((expData->operatingMode == ST_WAIT_BUTTON_REL) && (expData->sf3_sweep_mode)) {
+				Experiment_startSweep(expData);
+			}
+		} else {
+			expData->sf3_test_done = true;
+		}
+		break;
+
+	case ST_WAIT_BUTTON_REL:
+		if (expData->buttonsRead == 0x00000000) {
+			expData->operatingMode = ST_SET_PATTERN;
+		} else {
+			/* stay in state */
+		}
+		break;
+
+	case ST_SETUP_OPTIONS:
+		/* Lowering any switch leaves setup mode; buttons each change one option. */
+		if (expData->switchesRead != SWTCHS_SETUP_MASK) {
+			expData->operatingMode = ST_WAIT_BUTTON_DEP;
+		} else if (expData->buttonsRead == BTN0_MASK) {
+			expData->sf3_read_engine_selected =
+					(expData->sf3_read_engine_selected + 1) % SF3_READ_ENGINE_NONE;
+			expData->operatingMode = ST_SETUP_BUTTON_REL;
+		} else if (expData->buttonsRead == BTN1_MASK) {
+			expData->sf3_read_window_selected =
+					(expData->sf3_read_window_selected + 1) % SF3_READ_WINDOW_NONE;
+			expData->operatingMode = ST_SETUP_BUTTON_REL;
+		} else if (expData->buttonsRead == BTN2_MASK) {
+			/* Step through normal, fast, sweep, and fast sweep. */
+			expData->sf3_fast_mode = !(expData->sf3_fast_mode);
+			if (! expData->sf3_fast_mode)
+				expData->sf3_sweep_mode = !(expData->sf3_sweep_mode);
+			expData->operatingMode = ST_SETUP_BUTTON_REL;
+		} else if (expData->buttonsRead == BTN3_MASK) {
+			expData->sf3_test_pattern_bank =
+					(expData->sf3_test_pattern_bank + TEST_PATTERN_BANK_SIZE) % TEST_PATTERN_NONE;
+			expData->operatingMode = ST_SETUP_BUTTON_REL;
+		}
+		break;
+
+	case ST_SETUP_BUTTON_REL:
+		if (expData->buttonsRead == 0x00000000) {
+			expData->operatingMode = ST_SETUP_OPTIONS;
+		} else {
+			/* stay in state */
+		}
+		break;
+
+	case ST_SET_PATTERN:
+		/* A retention check verifies the range and pattern of the header. */
+		if (expData->sf3_verify_only) {
+			t_sf3_run_header header;
+
+			if (! Experiment_readRunHeader(expData, &header)) {
+				Log_Event(expData->deviceIndex, LOG_EVENT_HDR_NONE, 0, 0, 0, 0);
+				expData->sf3_verify_only = false;
+				expData->sf3_test_done = true;
+				expData->operatingMode = ST_WAIT_BUTTON_DEP;
+				break;
+			}
+
+			expData->sf3_test_pattern_selected = header.patternSelected;
+			expData->sf3_verify_start_val = header.startAddr;
+			expData->sf3_verify_byte_count = header.byteCount;
+			expData->sf3_verify_saved_addr = expData->sf3_addr_start_val;
+			expData->sf3_verify_saved_at_zero = expData->sf3_start_at_zero;
+		}
+
+		expData->sf3_pattern_page_kind = PATTERN_PAGE_NONE;
+
+		switch (expData->sf3_test_pattern_selected) {
+		case TEST_PATTERN_A:
+			expData->sf3_pattern_start_val = sf3_test_pattern_startval_a;
+			expData->sf3_pattern_incr_val = sf3_test_pattern_incrval_a;
+			break;
+		case TEST_PATTERN_B:
+			expData->sf3_pattern_start_val = sf3_test_pattern_startval_b;
+			expData->sf3_pattern_incr_val = sf3_test_pattern_incrval_b;
+			break;
+		case TEST_PATTERN_C:
+			expData->sf3_pattern_start_val = sf3_test_pattern_startval_c;
+			expData->sf3_pattern_incr_val = sf3_test_pattern_incrval_c;
+			break;
+		case TEST_PATTERN_D:
+			expData->sf3_pattern_start_val = sf3_test_pattern_startval_d;
+			expData->sf3_pattern_incr_val = sf3_test_pattern_incrval_d;
+			break;
+		case TEST_PATTERN_E:
+			expData->sf3_pattern_page_kind = PATTERN_PAGE_ADDRESS;
+			break;
+		case TEST_PATTERN_F:
+			expData->sf3_pattern_page_kind = PATTERN_PAGE_PRBS31;
+			break;
+		case TEST_PATTERN_G:
+			expData->sf3_pattern_page_kind = PATTERN_PAGE_WALKING_ONES;
+			break;
+		case TEST_PATTERN_H:
+			expData->sf3_pattern_page_kind = PATTERN_PAGE_INV_CHECKERBOARD;
+			break;
+		}
+
+		/* Every page of an arithmetic pattern run has the same contents,
+		 * so compute them once; page patterns are seeded per page instead. */
+		if (expData->sf3_pattern_page_kind == PATTERN_PAGE_NONE) {
+			Pattern_Fill(expData->PageImage, SF3_PAGE_SIZE,
+					expData->sf3_pattern_start_val, expData->sf3_pattern_incr_val);
+		}
+
+		expData->operatingMode = ST_SET_START_ADDR;
+		break;
+
+	case ST_SET_START_ADDR:
+		if (expData->sf3_verify_only) {
+			expData->sf3_addr_start_val = expData->sf3_verify_start_val;
+			iterByteCount = expData->sf3_verify_byte_count;
+			expData->sf3_test_done = false;
+			expData->operatingMode = ST_SET_START_WAIT;
+		} else if (expData->sf3_sweep_active) {
+			if (expData->sf3_start_at_zero) {
+				expData->sf3_addr_start_val = 0x00000000;
+				expData->operatingMode = ST_SET_START_WAIT;
+			} else if (expData->sf3_addr_start_val + experi_sweep_chunk_byte_count < max_possible_byte_count) {
+				expData->sf3_addr_start_val += experi_sweep_chunk_byte_count;
+				expData->operatingMode = ST_SET_START_WAIT;
+			} else {
+				/* The sweep has verified the last chunk of the device. */
+				Experiment_reportSweep(expData);
+				Experiment_writeRunHeader(expData, 0x00000000, sf3_header_addr);
+				expData->sf3_sweep_active = false;
+				expData->sf3_test_done = true;
+				expData->sf3_addr_start_val = 0x00000000;
+				expData->sf3_start_at_zero = true;
+				expData->operatingMode = ST_WAIT_BUTTON_DEP;
+				break;
+			}
+
+			/* The last chunk is shorter if the chunk size does not divide the device. */
+			iterByteCount = experi_sweep_chunk_byte_count;
+			if (iterByteCount > max_possible_byte_count - expData->sf3_addr_start_val)
+				iterByteCount = max_possible_byte_count - expData->sf3_addr_start_val;
+			expData->sf3_test_done = false;
+		} else if (SF3_WEAR_SCHEDULE) {
+			/* The wear record picks the region of the iteration. */
+			expData->sf3_addr_start_val = Wear_NextRegion(&(expData->wear)) * per_iteration_byte_count;
+			expData->sf3_test_done = false;
+			expData->operatingMode = ST_SET_START_WAIT;
+		} else if (expData->sf3_start_at_zero) {
+			expData->sf3_addr_start_val = 0x00000000;
+			expData->sf3_test_done = false;
+			expData->operatingMode = ST_SET_START_WAIT;
+		} else if (expData->sf3_addr_start_val < last_starting_byte_addr) {
+			expData->sf3_addr_start_val += per_iteration_byte_count;
+			expData->sf3_test_done = false;
+			expData->operatingMode = ST_SET_START_WAIT;
+		} else {
+			expData->sf3_test_done = true;
+			expData->operatingMode = ST_WAIT_BUTTON_DEP;
+		}
+
+		/* The header subsector at the end of the device is never tested. */
+		if (iterByteCount > sf3_header_addr - expData->sf3_addr_start_val)
+			iterByteCount = sf3_header_addr - expData->sf3_addr_start_val;
+
+		expData->sf3_iter_subsector_cnt = iterByteCount / sf3_subsector_addr_incr;
+		expData->sf3_iter_page_cnt = iterByteCount / sf3_page_addr_incr;
+
+		/* A sweep erases the whole device, header subsector included, with
+		 * one die or bulk erase ahead of its first chunk, and programs its
+		 * later chunks without an erase. */
+		expData->sf3_erase_start_val = expData->sf3_addr_start_val;
+		expData->sf3_erase_subsector_cnt = expData->sf3_iter_subsector_cnt;
+		if (expData->sf3_sweep_active) {
+			expData->sf3_erase_subsector_cnt = (expData->sf3_addr_start_val == 0x00000000) ?
+					(max_possible_byte_count / sf3_subsector_addr_incr) : 0;
+		}
+		expData->sf3_start_at_zero = false;
+		expData->sf3_i_val = 0;
+		expData->timing_reported = false;
+		expData->sf3_iter_err_count_base = expData->sf3_err_count_val;
+		expData->sf3_first_fail_valid = false;
+		expData->sf3_iter_aborted = false;
+
+		/* A sweep keeps one failure map for all of its chunks. */
+		if ((! expData->sf3_sweep_active) && (! expData->sf3_test_done)) {
+			FailMap_Clear(&(expData->failMap));
+		}
+		break;
+
+	case ST_SET_START_WAIT:
+		if ((expData->sf3_verify_only) &&
+				((expData->sf3_fast_mode) || (expData->cnt_t == cnt_t_max / 2))) {
+			/* Skip the erase and program phases, reading at full speed. */
+			Timing_PhaseStart(&(expData->timing_erase));
+			Timing_PhaseStart(&(expData->timing_program));
+			Timing_PhaseStart(&(expData->timing_read));
+			Timing_PhaseStart(&(expData->timing_read_1lane));
+			Experiment_resetXferPipeline(expData);
+			expData->operatingMode = ST_CMD_READ_START;
+		} else if ((expData->sf3_fast_mode) || (expData->cnt_t == cnt_t_max / 2)) {
+			Timing_PhaseStart(&(expData->timing_erase));
+			expData->sf3_erase_pending = false;
+			expData->operatingMode = (expData->sf3_erase_subsector_cnt > 0) ?
+					ST_CMD_ERASE_START : ST_CMD_ERASE_DONE;
+		}
+		break;
+
+	case ST_CMD_ERASE_START:
+		/* Issue one erase at a time, and poll its flag status once per step
+		 * until it completes or its timeout is spent; its latency is timed
+		 * from the write enable to the completion. The N25Q ignores commands
+		 * while it is busy, so a timed out erase is waited out for a second
+		 * timeout before the iteration ends, issuing no further command. */
+		if (! expData->sf3_erase_pending) {
+			expData->sf3_address_of_cmd = expData->sf3_erase_start_val + (expData->sf3_i_val * sf3_subsector_addr_incr);
+			expData->sf3_erase_granule = Experiment_selectEraseGranule(expData->sf3_address_of_cmd,
+					(expData->sf3_erase_subsector_cnt - expData->sf3_i_val) * sf3_subsector_addr_incr);
+			expData->sf3_erase_stamp = Timing_Now();
+			expData->sf3_erase_ticks = 0;
+			expData->sf3_erase_start_tick = xTaskGetTickCount();
+			expData->sf3_erase_pending = true;
+			eraseGranule = expData->sf3_erase_granule;
+
+			Status = SF3_FlashWriteEnable(expData->sf3Dev);
+
+			if (Status != XST_SUCCESS) {
+				Log_Event(expData->deviceIndex, LOG_EVENT_WEN_FAIL, 0, 0, 0, 0);
+			}
+
+			Status = c_sf3_erase_granules[eraseGranule].eraseFunc(expData->sf3Dev, expData->sf3_address_of_cmd);
+			Experiment_recordErase(expData, expData->sf3_address_of_cmd,
+					c_sf3_erase_granules[eraseGranule].byteCount);
+
+			if (Status != XST_SUCCESS) {
+				Log_Event(expData->deviceIndex, LOG_EVENT_ERS_FAIL, expData->sf3_address_of_cmd, 0, 0, 0);
+			}
+		}
+
+		eraseGranule = expData->sf3_erase_granule;
+		stamp = Timing_Now();
+		expData->sf3_erase_ticks += (u32)(stamp - expData->sf3_erase_stamp);
+		expData->sf3_erase_stamp = stamp;
+		eraseElapsed = xTaskGetTickCount() - expData->sf3_erase_start_tick;
+		if (Experiment_pollFlashReady(expData)) {
+			expData->sf3_erase_pending = false;
+		} else if ((! expData->sf3_iter_aborted) &&
+				(eraseElapsed >= pdMS_TO_TICKS(c_sf3_erase_granules[eraseGranule].timeoutMs))) {
+			Log_Event(expData->deviceIndex, LOG_EVENT_ERS_TIMEOUT, expData->sf3_address_of_cmd, 0, 0, 0);
+			expData->sf3_iter_aborted = true;
+		} else if (eraseElapsed >= 2 * pdMS_TO_TICKS(c_sf3_erase_granules[eraseGranule].timeoutMs)) {
+			expData->sf3_erase_pending = false;
+		}
+
+		if (! expData->sf3_erase_pending) {
+			Timing_RecordLatency(&(expData->timing_erase.cmdStats), expData->sf3_erase_ticks);
+			expData->timing_erase.byteCount += c_sf3_erase_granules[eraseGranule].byteCount;
+			expData->sf3_i_val += c_sf3_erase_granules[eraseGranule].byteCount / sf3_subsector_addr_incr;
+		}
+
+		/* The erase phase closes with the completion of its last erase, or
+		 * of the erase that timed out, which skips the program and read. */
+		Timing_PhaseUpdate(&(expData->timing_erase));
+		if (expData->sf3_erase_pending) {
+			expData->operatingMode = ST_CMD_ERASE_START;
+		} else if (expData->sf3_iter_aborted) {
+			expData->sf3_abort_count++;
+			Timing_PhaseStart(&(expData->timing_program));
+			Timing_PhaseStart(&(expData->timing_read));
+			Timing_PhaseStart(&(expData->timing_read_1lane));
+			expData->operatingMode = ST_DISPLAY_FINAL;
+		} else if (expData->sf3_i_val < expData->sf3_erase_subsector_cnt) {
+			expData->operatingMode = ST_CMD_ERASE_START;
+		} else {
+			expData->operatingMode = ST_CMD_ERASE_DONE;
+		}
+		break;
+
+	case ST_CMD_ERASE_DONE:
+		Experiment_resetXferPipeline(expData);
+
+		/* The last erase has completed, so fast mode programs at once, and
+		 * otherwise the hold only paces the display. */
+		if ((expData->sf3_fast_mode) || (expData->cnt_t >= cnt_t_max - 1)) {
+			Timing_PhaseStart(&(expData->timing_program));
+			expData->operatingMode = ST_CMD_PAGE_START;
+		} else {
+			expData->operatingMode = ST_CMD_ERASE_DONE;
+		}
+		break;
+
+	case ST_CMD_PAGE_START:
+		/* Copy the page image into one buffer while the transfer task
+		 * programs the other, until the step's time budget is spent or the
+		 * end of the iteration is reached. */
+		while ((expData->sf3_i_val < expData->sf3_iter_page_cnt) &&
+				(!Experiment_isStepBudgetSpent(expData))) {
+			if ((expData->sf3_i_issued < expData->sf3_iter_page_cnt) &&
+					(expData->sf3_xfer_in_flight < SF3_XFER_BUFFER_COUNT)) {
+				WriteBufferPtr = Experiment_writeXferBuffer(expData, expData->sf3_xfer_fill_idx);
+
+				xfer.xferType = SF3_XFER_PROGRAM;
+				xfer.address = expData->sf3_addr_start_val + (expData->sf3_i_issued * sf3_page_addr_incr);
+
+				Experiment_generatePage(expData, &(WriteBufferPtr[N25Q_WRITE_EXTRA_BYTES]), xfer.address);
+
+				xfer.byteCount = SF3_PAGE_SIZE;
+				xfer.pageCount = 1;
+				xfer.command = N25Q_PAGE_PROGRAM_CMD;
+				xfer.dummyBytes = 0;
+				xfer.buffer = WriteBufferPtr;
+				Experiment_sendXfer(expData, &xfer);
+			} else {
+				Experiment_receiveXfer(expData, &xfer);
+				expData->sf3_address_of_cmd = xfer.address;
+
+				if (xfer.statusWen != XST_SUCCESS) {
+					Log_Event(expData->deviceIndex, LOG_EVENT_WEN_FAIL, 0, 0, 0, 0);
+				}
+
+				if (xfer.status != XST_SUCCESS) {
+					Log_Event(expData->deviceIndex, LOG_EVENT_PRO_FAIL, expData->sf3_address_of_cmd, 0, 0, 0);
+				}
+			}
+		}
+
+		Timing_PhaseUpdate(&(expData->timing_program));
+		if (expData->sf3_i_val < expData->sf3_iter_page_cnt)
+			expData->operatingMode = ST_CMD_PAGE_START;
+		else
+			expData->operatingMode = ST_CMD_PAGE_DONE;
+		break;
+
+	case ST_CMD_PAGE_DONE:
+		Experiment_resetXferPipeline(expData);
+
+		/* In fast mode, the hold time is only a timeout for the program to complete. */
+		if ((expData->sf3_fast_mode) && (Experiment_pollFlashReady(expData))) {
+			/* The phase time includes the wait for the last program to complete. */
+			Timing_PhaseUpdate(&(expData->timing_program));
+			Timing_PhaseStart(&(expData->timing_read));
+			Timing_PhaseStart(&(expData->timing_read_1lane));
+			expData->operatingMode = ST_CMD_READ_START;
+		} else if (expData->cnt_t >= cnt_t_max - 1) {
+			Timing_PhaseStart(&(expData->timing_read));
+			Timing_PhaseStart(&(expData->timing_read_1lane));
+			expData->operatingMode = ST_CMD_READ_START;
+		} else {
+			expData->operatingMode = ST_CMD_PAGE_DONE;
+		}
+		break;
+
+	case ST_CMD_READ_START:
+		/* Stream one read window per command into one buffer while the other
+		 * buffer is compared page by page, until the step's time budget is
+		 * spent or the end of the iteration is reached. */
+		while ((expData->sf3_i_val < expData->sf3_iter_page_cnt) &&
+				(!Experiment_isStepBudgetSpent(expData))) {
+			if ((expData->sf3_i_issued < expData->sf3_iter_page_cnt) &&
+					(expData->sf3_xfer_in_flight < SF3_XFER_BUFFER_COUNT)) {
+				readByteCount = (expData->sf3_iter_page_cnt - expData->sf3_i_issued) * sf3_page_addr_incr;
+				if (readByteCount > readWindow->byteCount)
+					readByteCount = readWindow->byteCount;
+
+				ReadBufferPtr = Experiment_readXferBuffer(expData, expData->sf3_xfer_fill_idx,
+						readEngine->dummyBytes);
+				memset(&(ReadBufferPtr[N25Q_READ_EXTRA_BYTES + readEngine->dummyBytes]), 0x00, readByteCount);
+
+				xfer.xferType = SF3_XFER_READ;
+				xfer.address = expData->sf3_addr_start_val + (expData->sf3_i_issued * sf3_page_addr_incr);
+				xfer.byteCount = readByteCount;
+				xfer.pageCount = readByteCount / sf3_page_addr_incr;
+				xfer.command = readEngine->readCmd;
+				xfer.dummyBytes = readEngine->dummyBytes;
+				xfer.buffer = ReadBufferPtr;
+				Experiment_sendXfer(expData, &xfer);
+			} else {
+				Experiment_receiveXfer(expData, &xfer);
+				expData->sf3_address_of_cmd = xfer.address;
+
+				if (xfer.status != XST_SUCCESS) {
+					Log_Event(expData->deviceIndex, LOG_EVENT_RD_FAIL, expData->sf3_address_of_cmd, 0, 0, 0);
+				}
+
+				ReadPayloadPtr = &(xfer.buffer[N25Q_READ_EXTRA_BYTES + readEngine->dummyBytes]);
+				for (u32 iPage = 0; iPage < xfer.pageCount; ++iPage)
+				{
+					if (expData->sf3_pattern_page_kind != PATTERN_PAGE_NONE) {
+						Pattern_FillPage(expData->PageImage, SF3_PAGE_SIZE, expData->sf3_pattern_page_kind,
+								xfer.address + (iPage * sf3_page_addr_incr));
+					}
+
+					pageErrCount = Pattern_CountImageMismatches(ReadPayloadPtr,
+							expData->PageImage, SF3_PAGE_SIZE);
+
+					/* Map the failures of the page, only on the fail path. */
+					if (pageErrCount != 0) {
+						u32 offset = FailMap_RecordPage(&(expData->failMap),
+								xfer.address + (iPage * sf3_page_addr_incr),
+								ReadPayloadPtr, expData->PageImage, SF3_PAGE_SIZE);
+
+						if (! expData->sf3_first_fail_valid) {
+							expData->sf3_first_fail_addr = xfer.address + (iPage * sf3_page_addr_incr) + offset;
+							expData->sf3_first_fail_xor = ReadPayloadPtr[offset] ^ expData->PageImage[offset];
+							expData->sf3_first_fail_valid = true;
+						}
+					}
+
+					expData->sf3_err_count_val += pageErrCount;
+					ReadPayloadPtr += SF3_PAGE_SIZE;
+				}
+			}
+		}
+
+		Timing_PhaseUpdate(&(expData->timing_read));
+		if (expData->sf3_i_val < expData->sf3_iter_page_cnt)
+			expData->operatingMode = ST_CMD_READ_START;
+		else
+			expData->operatingMode = ST_CMD_READ_DONE;
+		break;
+
+	case ST_CMD_READ_DONE:
+		expData->sf3_i_val = 0;
+
+		if ((expData->sf3_fast_mode) || (expData->cnt_t >= cnt_t_max - 1)) {
+			expData->operatingMode = ST_DISPLAY_FINAL;
+		} else {
+			expData->operatingMode = ST_CMD_READ_DONE;
+		}
+		break;
+
+	case ST_DISPLAY_FINAL:
+		expData->sf3_test_pass = ((expData->sf3_err_count_val) || (expData->sf3_abort_count)) ? false : true;
+
+#if SF3_RESULT_STREAM
+		if (! expData->timing_reported) {
+			Experiment_streamResult(expData);
+		}
+#endif
+
+		/* Record the result of the iteration on the regions it tested. A
+		 * retention check neither wears the regions nor schedules them for a
+		 * retest when its read of an earlier run fails. */
+		if ((! expData->timing_reported) && (! expData->sf3_verify_only)) {
+			Wear_RecordRun(&(expData->wear), expData->sf3_addr_start_val,
+					expData->sf3_iter_page_cnt * sf3_page_addr_incr,
+					((expData->sf3_err_count_val != expData->sf3_iter_err_count_base) ||
+					(expData->sf3_iter_aborted)));
+		}
+
+		/* Report the iteration's phase timing once on entering the state;
+		 * a sweep instead accumulates the timing of its chunks, unless its
+		 * erase timed out, which ends the sweep at its first chunk. */
+		if ((! expData->timing_reported) && (expData->sf3_sweep_active) && (! expData->sf3_iter_aborted)) {
+			Timing_PhaseMerge(&(expData->sweep_erase), &(expData->timing_erase));
+			Timing_PhaseMerge(&(expData->sweep_program), &(expData->timing_program));
+			Timing_PhaseMerge(&(expData->sweep_read), &(expData->timing_read));
+			Timing_PhaseMerge(&(expData->sweep_read_1lane), &(expData->timing_read_1lane));
+			expData->timing_reported = true;
+		} else if (! expData->timing_reported) {
+			if (SF3_DEVICE_COUNT > 1) {
+				Experiment_logReport(expData, LOG_EVENT_DEV_RESULT, expData->sf3_test_pass,
+						expData->sf3_err_count_val, 0, 0);
+			}
+
+			if (! expData->sf3_verify_only) {
+				Experiment_reportPhaseTiming(expData, "ERS", &(expData->timing_erase));
+				Experiment_reportPhaseTiming(expData, "PRO", &(expData->timing_program));
+			}
+			Experiment_reportReadTiming(expData, &(expData->timing_read), &(expData->timing_read_1lane));
+			Experiment_reportIntrLatency(expData);
+			Experiment_reportFailMap(expData);
+			Experiment_reportWear(expData);
+			expData->timing_reported = true;
+
+			/* Record the written run for a later retention check. */
+			if ((! expData->sf3_verify_only) && (! expData->sf3_iter_aborted)) {
+				Experiment_writeRunHeader(expData, expData->sf3_addr_start_val,
+						expData->sf3_iter_page_cnt * sf3_page_addr_incr);
+			}
+		}
+
+		/* A sweep continues with its next chunk without a button press. */
+		if ((expData->sf3_fast_mode) || (expData->cnt_t == cnt_t_max - 1)) {
+			/* After a retention check, the writing iterations resume where they were. */
+			if (expData->sf3_verify_only) {
+				expData->sf3_addr_start_val = expData->sf3_verify_saved_addr;
+				expData->sf3_start_at_zero = expData->sf3_verify_saved_at_zero;
+				expData->sf3_verify_only = false;
+				expData->sf3_test_done = true;
+			}
+
+			if ((expData->sf3_iter_aborted) && (expData->sf3_sweep_active)) {
+				expData->sf3_sweep_active = false;
+				expData->sf3_test_done = true;
+				expData->sf3_addr_start_val = 0x00000000;
+				expData->sf3_start_at_zero = true;
+			}
+
+			expData->operatingMode = (expData->sf3_sweep_active) ? ST_SET_START_ADDR : ST_WAIT_BUTTON_DEP;
+		}
+		break;
+
+	default: /* If state unknown or NONE, then transition to waiting for button/switch depress. */
+		expData->operatingMode = ST_WAIT_BUTTON_DEP;
+		break;
+	}
+}
+
+/* Helper function to restart the ping-pong pipeline at the first page. */
+static void Experiment_resetXferPipeline(t_experiment_data* expData) {
+	expData->sf3_i_val = 0;
+	expData->sf3_i_issued = 0;
+	expData->sf3_xfer_in_flight = 0;
+	expData->sf3_xfer_fill_idx = 0;
+}
+
+/* Helper functions to return a transfer buffer, positioned so that the
+ * payload after the command, address and dummy bytes starts on a cache line.
+ */
+static u8* Experiment_writeXferBuffer(t_experiment_data* expData, int bufferIndex) {
+	return &(expData->xferBuffers->Write[bufferIndex][SF3_XFER_HEADER_ROOM - N25Q_WRITE_EXTRA_BYTES]);
+}
+
+static u8* Experiment_readXferBuffer(t_experiment_data* expData, int bufferIndex, u8 dummyBytes) {
+	return &(expData->xferBuffers->Read[bufferIndex][SF3_XFER_HEADER_ROOM - N25Q_READ_EXTRA_BYTES - dummyBytes]);
+}
+
+/* Helper function to queue a transfer of the buffer just filled and advance
+ * to filling the next buffer.
+ */
+static void Experiment_sendXfer(t_experiment_data* expData, t_sf3_xfer* xfer) {
+	xQueueSend(xQueueSf3Xfer[expData->deviceIndex], xfer, portMAX_DELAY);
+
+	expData->sf3_i_issued += xfer->pageCount;
+	expData->sf3_xfer_in_flight += 1;
+	expData->sf3_xfer_fill_idx = (expData->sf3_xfer_fill_idx + 1) % SF3_XFER_BUFFER_COUNT;
+}
+
+/* Helper function to wait for the oldest transfer in flight. */
+static void Experiment_receiveXfer(t_experiment_data* expData, t_sf3_xfer* xfer) {
+	xQueueReceive(xQueueSf3XferDone[expData->deviceIndex], xfer, portMAX_DELAY);
+
+	expData->sf3_xfer_in_flight -= 1;
+	expData->sf3_i_val += xfer->pageCount;
+
+	if (xfer->xferType == SF3_XFER_PROGRAM) {
+		Timing_RecordLatency(&(expData->timing_program.cmdStats), xfer->latencyTicks);
+		expData->timing_program.byteCount += xfer->byteCount;
+	} else if (N25Q_IsReadFallback(xfer->address, xfer->byteCount, xfer->command)) {
+		Timing_RecordLatency(&(expData->timing_read_1lane.cmdStats), xfer->latencyTicks);
+		expData->timing_read_1lane.byteCount += xfer->byteCount;
+		expData->timing_read_1lane.elapsedTicks += xfer->latencyTicks;
+	} else {
+		Timing_RecordLatency(&(expData->timing_read.cmdStats), xfer->latencyTicks);
+		expData->timing_read.byteCount += xfer->byteCount;
+	}
+}
+
+/* Helper function to poll the N25Q flag status register for completion of the
+ * last program or erase, reporting any program, erase, or protection error.
+ */
+static bool Experiment_pollFlashReady(t_experiment_data* expData) {
+	u8 flagStatus = 0x00;
+	XStatus Status;
+
+	Status = N25Q_ReadFlagStatus(expData->sf3Dev, &flagStatus);
+
+	if (Status != XST_SUCCESS) {
+		Log_Event(expData->deviceIndex, LOG_EVENT_FSR_FAIL, 0, 0, 0, 0);
+		return false;
+	}
+
+	if ((flagStatus & N25Q_FLAG_STATUS_READY_MASK) == 0) {
+		return false;
+	}
+
+	if (flagStatus & N25Q_FLAG_STATUS_ERR_MASK) {
+		Log_Event(expData->deviceIndex, LOG_EVENT_FSR_ERR, flagStatus, 0, 0, 0);
+	}
+
+	return true;
+}
+
+/* Helper function to select the largest erase command that is aligned at the
+ * erase address and does not extend past the end of the erase range. On a
+ * single die part, the bulk erase is the same size as, and selected instead
+ * of, the die erase. Only the whole device range of a sweep is large enough
+ * for a die or bulk erase.
+ */
+static int Experiment_selectEraseGranule(u32 eraseAddr, u32 eraseByteCount) {
+	int eraseGranule = SF3_ERASE_SUBSECTOR;
+
+	for (int iGranule = SF3_ERASE_SUBSECTOR + 1; iGranule < SF3_ERASE_NONE; ++iGranule) {
+		/* A multiple die part, such as the N25Q512, has no bulk erase. */
+		if ((iGranule == SF3_ERASE_BULK) && (max_possible_byte_count > N25Q_DIE_SIZE))
+			continue;
+
+		/* The die erase only has a 3-byte address. */
+		if ((iGranule == SF3_ERASE_DIE) && (eraseAddr >= N25Q_ADDR_3BYTE_LIMIT))
+			continue;
+
+		if ((eraseAddr % c_sf3_erase_granules[iGranule].byteCount == 0) &&
+				(eraseByteCount >= c_sf3_erase_granules[iGranule].byteCount)) {
+			eraseGranule = iGranule;
+		}
+	}
+
+	return eraseGranule;
+}
+
+/* Helper function to count an erase in the wear record; the header subsector
+ * erased with the whole device by a sweep does not wear the tested regions.
+ */
+static void Experiment_recordErase(t_experiment_data* expData, u32 eraseAddr, u32 eraseByteCount) {
+	if (eraseAddr + eraseByteCount > sf3_header_addr) {
+		Wear_RecordErase(&(expData->wear), eraseAddr, sf3_header_addr - eraseAddr);
+		Wear_RecordReservedErase(&(expData->wear), sf3_header_addr,
+				eraseAddr + eraseByteCount - sf3_header_addr);
+	} else {
+		Wear_RecordErase(&(expData->wear), eraseAddr, eraseByteCount);
+	}
+}
+
+/* Helper function to generate the test pattern contents of the page at the
+ * page address, either copied from the run's page image or seeded directly
+ * from the page address for the address-dependent patterns.
+ */
+static void Experiment_generatePage(t_experiment_data* expData, u8* dst, u32 pageAddr) {
+	if (expData->sf3_pattern_page_kind == PATTERN_PAGE_NONE) {
+		memcpy(dst, expData->PageImage, SF3_PAGE_SIZE);
+	} else {
+		Pattern_FillPage(dst, SF3_PAGE_SIZE, expData->sf3_pattern_page_kind, pageAddr);
+	}
+}
+
+/* Helper function to indicate the erase, program and read phases that step
+ * back-to-back instead of once per 10 millisecond period.
+ */
+static bool Experiment_isActivePhase(t_experiment_data* expData) {
+	return ((expData->operatingMode == ST_CMD_ERASE_START) ||
+			(expData->operatingMode == ST_CMD_PAGE_START) ||
+			(expData->operatingMode == ST_CMD_READ_START));
+}
+
+/* Helper function to indicate that an erase is in progress, whose flag status
+ * the erase phase polls once per tick rather than back-to-back.
+ */
+static bool Experiment_isErasePending(t_experiment_data* expData) {
+	return ((expData->operatingMode == ST_CMD_ERASE_START) && (expData->sf3_erase_pending));
+}
+
+/* Helper function to indicate that the FSM is computing the pattern or the
+ * address range of the next iteration, which holds on neither the period nor
+ * a transfer, so it steps without waiting for either. */
+static bool Experiment_isSetupStep(t_experiment_data* expData) {
+	return ((expData->operatingMode == ST_SET_PATTERN) ||
+			(expData->operatingMode == ST_SET_START_ADDR));
+}
+
+/* Helper function to indicate that the current FSM step has run for its time
+ * budget, rounded up to one tick.
+ */
+static bool Experiment_isStepBudgetSpent(t_experiment_data* expData) {
+	TickType_t budgetTicks = pdMS_TO_TICKS(EXPERI_STEP_BUDGET_MS);
+
+	if (budgetTicks == 0)
+		budgetTicks = 1;
+
+	return ((xTaskGetTickCount() - expData->step_start_tick) >= budgetTicks);
+}
+
+/* Helper function to sum the error counts of all of the SF3 devices. */
+static uint32_t Experiment_totalErrCount(void) {
+	uint32_t errCount = 0;
+
+	for (int iDev = 0; iDev < SF3_DEVICE_COUNT; ++iDev) {
+		errCount += experiData[iDev].sf3_err_count_val;
+	}
+
+	return errCount;
+}
+
+/* Helper function to indicate that every SF3 device passed its last test. */
+static bool Experiment_allDevicesPass(void) {
+	for (int iDev = 0; iDev < SF3_DEVICE_COUNT; ++iDev) {
+		if (! experiData[iDev].sf3_test_pass)
+			return false;
+	}
+
+	return true;
+}
+
+/* Helper function to indicate that every SF3 device is done testing. */
+static bool Experiment_allDevicesDone(void) {
+	for (int iDev = 0; iDev < SF3_DEVICE_COUNT; ++iDev) {
+		if (! experiData[iDev].sf3_test_done)
+			return false;
+	}
+
+	return true;
+}
+
+/* Helper function to start a sweep of the device from its first chunk. */
+static void Experiment_startSweep(t_experiment_data* expData) {
+	expData->sf3_sweep_active = true;
+	expData->sf3_start_at_zero = true;
+	expData->sf3_sweep_err_count_base = expData->sf3_err_count_val;
+	Timing_PhaseStart(&(expData->sweep_erase));
+	Timing_PhaseStart(&(expData->sweep_program));
+	Timing_PhaseStart(&(expData->sweep_read));
+	Timing_PhaseStart(&(expData->sweep_read_1lane));
+	FailMap_Clear(&(expData->failMap));
+}
+
+/* Helper function to print the aggregated result and phase timing of a
+ * completed sweep of the device.
+ */
+static void Experiment_reportSweep(t_experiment_data* expData) {
+	Experiment_logReport(expData, LOG_EVENT_SWEEP, max_possible_byte_count / 1024,
+			expData->sf3_err_count_val - expData->sf3_sweep_err_count_base, 0, 0);
+#if SF3_RESULT_STREAM
+	Experiment_logReport(expData, LOG_EVENT_STREAM_SWEEP, max_possible_byte_count,
+			expData->sf3_err_count_val - expData->sf3_sweep_err_count_base, 0, 0);
+#endif
+
+	Experiment_reportPhaseTiming(expData, "ERS", &(expData->sweep_erase));
+	Experiment_reportPhaseTiming(expData, "PRO", &(expData->sweep_program));
+	Experiment_reportReadTiming(expData, &(expData->sweep_read), &(expData->sweep_read_1lane));
+	Experiment_reportFailMap(expData);
+}
+
+/* Helper function to log one report event, waiting briefly for the print
+ * task so that none of the report lines is lost.
+ */
+static void Experiment_logReport(t_experiment_data* expData, int eventId,
+		UINTPTR arg0, UINTPTR arg1, UINTPTR arg2, UINTPTR arg3) {
+	t_log_record* record = Log_Reserve(expData->deviceIndex, pdMS_TO_TICKS(100));
+
+	if (record != NULL) {
+		record->eventId = (u8) eventId;
+		record->args[0] = arg0;
+		record->args[1] = arg1;
+		record->args[2] = arg2;
+		record->args[3] = arg3;
+		Log_Commit(expData->deviceIndex);
+	}
+}
+
+/* Helper function to compute the timing of the reads of the selected engine,
+ * without the time of the windows that fell back to the single lane read.
+ */
+static void Experiment_engineReadTiming(t_timing_phase* engineRead, const t_timing_phase* read,
+		const t_timing_phase* read1Lane) {
+	*engineRead = *read;
+	engineRead->elapsedTicks = (read->elapsedTicks > read1Lane->elapsedTicks) ?
+			(read->elapsedTicks - read1Lane->elapsedTicks) : 0;
+}
+
+/* Helper function to print the timing of the read phase as "TST" for the
+ * selected engine and, if any window fell back to the single lane read, as
+ * "T1L" for those windows.
+ */
+static void Experiment_reportReadTiming(t_experiment_data* expData, const t_timing_phase* read,
+		const t_timing_phase* read1Lane) {
+	t_timing_phase engineRead;
+
+	Experiment_engineReadTiming(&engineRead, read, read1Lane);
+	Experiment_reportPhaseTiming(expData, "TST", &engineRead);
+
+	if (read1Lane->cmdStats.count > 0) {
+		Experiment_reportPhaseTiming(expData, "T1L", read1Lane);
+	}
+}
+
+/* Helper function to print the throughput, command latency minimum/average/
+ * maximum and non-empty latency histogram bins of one phase to the terminal.
+ * The lines block briefly on the log so that none of them is dropped.
+ */
+static void Experiment_reportPhaseTiming(t_experiment_data* expData, const char* label,
+		const t_timing_phase* phase) {
+	const TickType_t xPrintTimeout = pdMS_TO_TICKS(100);
+	const t_timing_stats* stats = &(phase->cmdStats);
+	t_log_record* record;
+	int len = 0;
+
+	Experiment_logReport(expData, LOG_EVENT_PHASE_RATE, (UINTPTR) label,
+			Timing_PhaseKBytesPerSec(phase), stats->count, 0);
+
+	if (stats->count == 0) {
+		return;
+	}
+
+	Experiment_logReport(expData, LOG_EVENT_PHASE_US, (UINTPTR) label,
+			Timing_TicksToUs(stats->minTicks), Timing_AverageUs(stats),
+			Timing_TicksToUs(stats->maxTicks));
+
+	/* Histogram bins as log2(us):count, wrapped to the log text width and
+	 * formatted in place in the log records. */
+	record = NULL;
+	for (int iBin = 0; iBin < TIMING_HISTOGRAM_BIN_COUNT; ++iBin) {
+		char binText[PRINTF_BUF_SZ];
+		int binLen;
+
+		if (stats->histogram[iBin] == 0) {
+			continue;
+		}
+
+		binLen = snprintf(binText, sizeof(binText), " %d:%lu", iBin,
+				(unsigned long) stats->histogram[iBin]);
+		if ((record != NULL) && (len + binLen >= PRINTF_BUF_SZ)) {
+			Log_Commit(expData->deviceIndex);
+			record = NULL;
+		}
+
+		if (record == NULL) {
+			record = Log_Reserve(expData->deviceIndex, xPrintTimeout);
+			if (record == NULL) {
+				return;
+			}
+			record->eventId = LOG_EVENT_TEXT;
+			len = snprintf(record->text, PRINTF_BUF_SZ, "%s%s h", expData->devTag, label);
+		}
+
+		strcpy(&(record->text[len]), binText);
+		len += binLen;
+	}
+
+	if (record != NULL) {
+		Log_Commit(expData->deviceIndex);
+	}
+}
+
+/* Helper function to print the minimum, average and maximum write-enable
+ * completion latency since power-up, copied from under the interrupt handler.
+ */
+static void Experiment_reportIntrLatency(t_experiment_data* expData) {
+	t_timing_stats stats;
+
+	taskENTER_CRITICAL();
+	stats = expData->qspi_intr_stats;
+	taskEXIT_CRITICAL();
+
+	if (stats.count == 0) {
+		return;
+	}
+
+	Experiment_logReport(expData, LOG_EVENT_PHASE_US, (UINTPTR) "WEC",
+			Timing_TicksToUs(stats.minTicks), Timing_AverageUs(&stats),
+			Timing_TicksToUs(stats.maxTicks));
+}
+
+/* Helper function to print the failure map of a failed iteration or sweep:
+ * the failing subsector count and worst subsector, the failing bits, and the
+ * first failing bytes with their expected and actual contents.
+ */
+static void Experiment_reportFailMap(t_experiment_data* expData) {
+	const t_failmap* map = &(expData->failMap);
+	u32 worst;
+
+	if (map->errCount == 0)
+		return;
+
+	worst = FailMap_WorstSubsector(map);
+	Experiment_logReport(expData, LOG_EVENT_FMAP_SUB, map->failSubsectorCount,
+			worst * N25Q_SUBSECTOR_SIZE, map->subsectorErrCounts[worst], 0);
+	Experiment_logReport(expData, LOG_EVENT_FMAP_BITS, map->xorMask,
+			map->stuckHighMask, map->stuckLowMask, 0);
+
+	for (u32 iEntry = 0; iEntry < map->entryCount; ++iEntry) {
+		Experiment_logReport(expData, LOG_EVENT_FMAP_ENTRY, map->entries[iEntry].address,
+				map->entries[iEntry].expected, map->entries[iEntry].actual, 0);
+	}
+}
+
+/* Helper function to print the wear of the region of the iteration, the wear
+ * of the least erased region, and the count of regions covered. */
+static void Experiment_reportWear(t_experiment_data* expData) {
+	const t_wear* wear = &(expData->wear);
+	const u32 iRegion = expData->sf3_addr_start_val / per_iteration_byte_count;
+
+	if (iRegion >= wear->regionCount)
+		return;
+
+	Experiment_logReport(expData, LOG_EVENT_WEAR, iRegion * per_iteration_byte_count,
+			wear->regions[iRegion].eraseCount, Wear_LeastErased(wear), wear->coveredCount);
+}
+
+/* Helper function to compute the check word of a run header. */
+static u32 Experiment_runHeaderCheck(const t_sf3_run_header* header) {
+	return ~(header->magic ^ header->startAddr ^ header->byteCount ^ header->patternSelected);
+}
+
+/* Helper function to wait for the N25Q to complete an erase or program
+ * outside of the test phases, with a timeout of the longest subsector erase.
+ */
+static bool Experiment_waitFlashReady(t_experiment_data* expData) {
+	const TickType_t xTimeout = pdMS_TO_TICKS(800);
+	const TickType_t xStartTick = xTaskGetTickCount();
+
+	while (! Experiment_pollFlashReady(expData)) {
+		if (xTaskGetTickCount() - xStartTick >= xTimeout) {
+			return false;
+		}
+		vTaskDelay(1);
+	}
+
+	return true;
+}
+
+/* Helper function to record the range and pattern of a written run in the
+ * next unused page of the header subsector, erasing the subsector first only
+ * if all of its pages are used. The erase is counted in the wear record. The
+ * transfer pipeline is idle, so the first write buffer holds the header.
+ */
+static void Experiment_writeRunHeader(t_experiment_data* expData, u32 startAddr, u32 byteCount) {
+	u8* BufferPtr = Experiment_writeXferBuffer(expData, 0);
+	t_sf3_run_header header;
+	t_sf3_run_header lastHeader;
+	bool headerFound;
+	u32 freeSlot;
+	XStatus Status = XST_SUCCESS;
+
+	header.magic = SF3_RUN_HEADER_MAGIC;
+	header.startAddr = startAddr;
+	header.byteCount = byteCount;
+	header.patternSelected = expData->sf3_test_pattern_selected;
+	header.checkWord = Experiment_runHeaderCheck(&header);
+	memcpy(&(BufferPtr[N25Q_WRITE_EXTRA_BYTES]), &header, sizeof(header));
+
+	if (! Experiment_scanRunHeaders(expData, &lastHeader, &headerFound, &freeSlot)) {
+		Status = XST_FAILURE;
+	} else if (freeSlot == SF3_RUN_HEADER_SLOT_COUNT) {
+		Status = SF3_FlashWriteEnable(expData->sf3Dev);
+		if (Status == XST_SUCCESS) {
+			Status = N25Q_SubsectorErase(expData->sf3Dev, sf3_header_addr);
+		}
+
+		if (Status == XST_SUCCESS) {
+			Wear_RecordReservedErase(&(expData->wear), sf3_header_addr, N25Q_SUBSECTOR_SIZE);
+			Experiment_logReport(expData, LOG_EVENT_HDR_ERASE, sf3_header_addr,
+					expData->wear.subsectorEraseCounts[sf3_header_addr / N25Q_SUBSECTOR_SIZE], 0, 0);
+
+			if (! Experiment_waitFlashReady(expData)) {
+				Status = XST_FAILURE;
+			}
+		}
+
+		freeSlot = 0;
+	}
+
+	if (Status == XST_SUCCESS) {
+		Status = SF3_FlashWriteEnable(expData->sf3Dev);
+		if (Status == XST_SUCCESS) {
+			Status = N25Q_FlashWrite(expData->sf3Dev, sf3_header_addr + (freeSlot * sf3_page_addr_incr),
+					sizeof(header), N25Q_PAGE_PROGRAM_CMD, &(BufferPtr));
+		}
+		if ((Status == XST_SUCCESS) && (! Experiment_waitFlashReady(expData))) {
+			Status = XST_FAILURE;
+		}
+	}
+
+	if (Status != XST_SUCCESS) {
+		Experiment_logReport(expData, LOG_EVENT_HDR_FAIL, sf3_header_addr, 0, 0, 0);
+	}
+}
+
+/* Helper function to read the pages of the header subsector in order, up to
+ * the first unused page, returning false if a read fails. The last valid
+ * header read is returned with headerFound set, and the first unused page is
+ * returned, or SF3_RUN_HEADER_SLOT_COUNT if every page is used.
+ */
+static bool Experiment_scanRunHeaders(t_experiment_data* expData, t_sf3_run_header* header,
+		bool* headerFound, u32* freeSlot) {
+	t_sf3_run_header slotHeader;
+	u8* BufferPtr;
+
+	*headerFound = false;
+	*freeSlot = SF3_RUN_HEADER_SLOT_COUNT;
+
+	for (u32 iSlot = 0; iSlot < SF3_RUN_HEADER_SLOT_COUNT; ++iSlot) {
+		BufferPtr = Experiment_readXferBuffer(expData, 0, 0);
+
+		if (N25Q_FlashRead(expData->sf3Dev, sf3_header_addr + (iSlot * sf3_page_addr_incr),
+				sizeof(slotHeader), N25Q_READ_CMD, 0, &(BufferPtr)) != XST_SUCCESS) {
+			return false;
+		}
+
+		memcpy(&slotHeader, &(Experiment_readXferBuffer(expData, 0, 0)[N25Q_READ_EXTRA_BYTES]),
+				sizeof(slotHeader));
+
+		if (slotHeader.magic == SF3_RUN_HEADER_ERASED) {
+			*freeSlot = iSlot;
+			break;
+		}
+
+		if (Experiment_isRunHeaderValid(&slotHeader)) {
+			*header = slotHeader;
+			*headerFound = true;
+		}
+	}
+
+	return true;
+}
+
+/* Helper function to read the header subsector, returning true if it holds a
+ * valid header of a run within the tested range of the device, the header of
+ * the last written run.
+ */
+static bool Experiment_readRunHeader(t_experiment_data* expData, t_sf3_run_header* header) {
+	bool headerFound;
+	u32 freeSlot;
+
+	return ((Experiment_scanRunHeaders(expData, header, &headerFound, &freeSlot)) && (headerFound));
+}
+
+/* Helper function to indicate that a header read from the header subsector is
+ * valid and describes a run within the tested range of the device.
+ */
+static bool Experiment_isRunHeaderValid(const t_sf3_run_header* header) {
+	return ((header->magic == SF3_RUN_HEADER_MAGIC) &&
+			(header->checkWord == Experiment_runHeaderCheck(header)) &&
+			(header->patternSelected < TEST_PATTERN_NONE) &&
+			(header->byteCount != 0) &&
+			(header->startAddr % sf3_page_addr_incr == 0) &&
+			(header->byteCount % sf3_page_addr_incr == 0) &&
+			(header->startAddr < sf3_header_addr) &&
+			(header->byteCount <= sf3_header_addr - header->startAddr));
+}
+
+#if SF3_RESULT_STREAM
+/* Helper function to log the result stream records of one iteration: the
+ * address range, pattern and error count, the first failure, and the elapsed
+ * time, throughput and command count of each phase, with the reads that fell
+ * back to the single lane read apart from those of the selected engine.
+ */
+static void Experiment_streamResult(t_experiment_data* expData) {
+	t_timing_phase engineRead;
+	const t_timing_phase* phases[4] = {&(expData->timing_erase),
+			&(expData->timing_program), &engineRead, &(expData->timing_read_1lane)};
+	static const char* const phaseLabels[4] = {"ERS", "PRO", "TST", "T1L"};
+	const int phaseCount = (expData->timing_read_1lane.cmdStats.count > 0) ? 4 : 3;
+
+	Experiment_engineReadTiming(&engineRead, &(expData->timing_read), &(expData->timing_read_1lane));
+
+	Experiment_logReport(expData, LOG_EVENT_STREAM_ITER, expData->sf3_addr_start_val,
+			expData->sf3_iter_page_cnt * sf3_page_addr_incr,
+			'A' + expData->sf3_test_pattern_selected - TEST_PATTERN_A,
+			expData->sf3_err_count_val - expData->sf3_iter_err_count_base);
+
+	if (expData->sf3_first_fail_valid) {
+		Experiment_logReport(expData, LOG_EVENT_STREAM_FAIL, expData->sf3_first_fail_addr,
+				expData->sf3_first_fail_xor, 0, 0);
+	}
+
+	for (int iPhase = 0; iPhase < phaseCount; ++iPhase) {
+		Experiment_logReport(expData, LOG_EVENT_STREAM_PHASE, (UINTPTR) phaseLabels[iPhase],
+				Timing_TicksToUs(phases[iPhase]->elapsedTicks),
+				Timing_PhaseKBytesPerSec(phases[iPhase]), phases[iPhase]->cmdStats.count);
+	}
+}
+#endif
+
+#if SF3_RESULT_STREAM && SF3_KERNEL_BENCHMARK
+/* Pattern kernels timed at startup, each over SF3_KERNEL_BENCH_PAGES pages. */
+#define SF3_KERNEL_BENCH_PAGES 256
+#define SF3_KERNEL_BENCH_COUNT 7
+
+/* Helper function to time the pattern kernels over a run of pages and log
+ * the CPU cycles per page and the throughput of each, so that a change to a
+ * kernel can be compared on the board before a flash test is started. The
+ * kernels run on the aligned payload of the first read buffer, as in a test.
+ */
+static void Experiment_benchmarkKernels(t_experiment_data* expData) {
+	static const char* const kernelLabels[SF3_KERNEL_BENCH_COUNT] = {
+			"FIL", "FRF", "PRB", "CMP", "CMF", "CNT", "CRF"};
+	u8* page = &(expData->xferBuffers->Read[0][SF3_XFER_HEADER_ROOM]);
+	t_timing_phase bench;
+	volatile u32 errCount = 0;
+
+	Pattern_Fill(expData->PageImage, SF3_PAGE_SIZE, 0x00, 0x01);
+
+	for (int iKernel = 0; iKernel < SF3_KERNEL_BENCH_COUNT; ++iKernel) {
+		/* The pass compare reads a matching page, the others a page of which
+		 * every byte differs from the image. */
+		Pattern_Fill(page, SF3_PAGE_SIZE, (iKernel == 3) ? 0x00 : 0x80, 0x01);
+
+		Timing_PhaseStart(&bench);
+		for (u32 iPage = 0; iPage < SF3_KERNEL_BENCH_PAGES; ++iPage) {
+			switch (iKernel) {
+			case 0:
+				Pattern_Fill(page, SF3_PAGE_SIZE, (u8) iPage, 0x01);
+				break;
+			case 1:
+				Pattern_FillRef(page, SF3_PAGE_SIZE, (u8) iPage, 0x01);
+				break;
+			case 2:
+				Pattern_FillPage(page, SF3_PAGE_SIZE, PATTERN_PAGE_PRBS31, iPage * SF3_PAGE_SIZE);
+				break;
+			case 3:
+			case 4:
+				errCount += Pattern_CountImageMismatches(page, expData->PageImage, SF3_PAGE_SIZE);
+				break;
+			case 5:
+				errCount += Pattern_CountMismatches(page, SF3_PAGE_SIZE, 0x00, 0x01);
+				break;
+			default:
+				errCount += Pattern_CountMismatchesRef(page, SF3_PAGE_SIZE, 0x00, 0x01);
+				break;
+			}
+		}
+		Timing_PhaseUpdate(&bench);
+		bench.byteCount = SF3_KERNEL_BENCH_PAGES * SF3_PAGE_SIZE;
+
+		Experiment_logReport(expData, LOG_EVENT_STREAM_KERNEL, (UINTPTR) kernelLabels[iKernel],
+				Timing_TicksToCpuCycles(bench.elapsedTicks / SF3_KERNEL_BENCH_PAGES),
+				Timing_PhaseKBytesPerSec(&bench), 0);
+	}
+}
+#endif
+
+/* Timer function similar to VHDL/Verilog FSM Timer strategy #1. */
+static void Experiment_iterationTimer(t_experiment_data* expData) {
+	/* Reset timer on 15 iterations or change in operating mode */
+	if (expData->operatingMode != expData->operatingModePrev) {
+		expData->cnt_t = 0;
+	} else {
+		expData->cnt_t = (expData->cnt_t + 1) % cnt_t_max; /* 3 seconds of counting on 10 ms timer */
+	}
+
+	expData->cnt_t_freerun = (expData->cnt_t_freerun + 1) % cnt_t_max; /* 3 seconds of counting on 10 ms timer */
+
+	/* Track operating mode history (only one step back) */
+	expData->operatingModePrev = expData->operatingMode;
+}
@@ -0,0 +1,191 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2020 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+-- \file Experiment.h
+--
+-- \brief A SoPC top-level design with the PMOD SF3 FreeRTOS driver.
+-- This design erases a group of subsectors, programs the subsectors, and then
+-- byte-compares the contents of the subsectors. The progress is displayed on
+-- a PMOD CLS 16x2 dot-matrix LCD and printed on a USB-UART display terminal.
+------------------------------------------------------------------------------*/
+#ifndef _EXPERIMENT_H_
+#define _EXPERIMENT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+#include "sf3_failmap.h"
+#include "sf3_board.h"
+
+#define PRINTF_BUF_SZ 34
+#define DELAY_10_SECONDS	10000UL
+#define DELAY_1_SECOND		1000UL
+
+enum OPERATING_MODE_TAG {
+	ST_WAIT_BUTTON_DEP,
+	ST_WAIT_BUTTON_REL,
+	ST_SET_PATTERN,
+	ST_SET_START_ADDR,
+	ST_SET_START_WAIT,
+	ST_CMD_ERASE_START,
+	ST_CMD_ERASE_DONE,
+	ST_CMD_PAGE_START,
+	ST_CMD_PAGE_DONE,
+	ST_CMD_READ_START,
+	ST_CMD_READ_DONE,
+	ST_DISPLAY_FINAL,
+	ST_SETUP_OPTIONS,
+	ST_SETUP_BUTTON_REL,
+	OPERATING_MODE_NONE
+};
+
+enum TEST_PATTERN_TAG {
+	TEST_PATTERN_A,
+	TEST_PATTERN_B,
+	TEST_PATTERN_C,
+	TEST_PATTERN_D,
+	TEST_PATTERN_E,
+	TEST_PATTERN_F,
+	TEST_PATTERN_G,
+	TEST_PATTERN_H,
+	TEST_PATTERN_NONE
+};
+
+/* Test patterns A-D repeat one pattern image on every page; patterns E-H
+ * (address-in-data, PRBS-31, walking ones, inverse checkerboard) depend on
+ * the page address. The four buttons select within the bank chosen in setup mode. */
+#define TEST_PATTERN_BANK_SIZE 4
+
+/* Read commands selectable for the verification phase. */
+enum SF3_READ_ENGINE_TAG {
+	SF3_READ_ENGINE_STANDARD,
+	SF3_READ_ENGINE_DUAL_OUTPUT,
+	SF3_READ_ENGINE_DUAL_IO,
+	SF3_READ_ENGINE_QUAD_OUTPUT,
+	SF3_READ_ENGINE_QUAD_IO,
+	SF3_READ_ENGINE_NONE
+};
+
+/* The read engine selected at power-up; changed at run-time in setup mode. */
+#define SF3_READ_ENGINE_DEFAULT SF3_READ_ENGINE_QUAD_IO
+
+/* Streaming read window lengths, each a single read command spanning pages. */
+enum SF3_READ_WINDOW_TAG {
+	SF3_READ_WINDOW_PAGE,
+	SF3_READ_WINDOW_4KIB,
+	SF3_READ_WINDOW_16KIB,
+	SF3_READ_WINDOW_64KIB,
+	SF3_READ_WINDOW_NONE
+};
+
+/* The read window selected at power-up; changed at run-time in setup mode. */
+#define SF3_READ_WINDOW_DEFAULT SF3_READ_WINDOW_64KIB
+#define SF3_READ_WINDOW_MAX_BYTES 65536
+
+/* Fast mode gates phase transitions on the N25Q flag status instead of the
+ * fixed display hold times; selected at power-up, changed in setup mode. */
+#define SF3_FAST_MODE_DEFAULT false
+
+/* Sweep mode runs erase, program and verify over every chunk of the device
+ * from one button press; selected at power-up, changed in setup mode. */
+#define SF3_SWEEP_MODE_DEFAULT false
+
+/* Set to 0 to omit the machine-readable result stream lines from the terminal. */
+#ifndef SF3_RESULT_STREAM
+#define SF3_RESULT_STREAM 1
+#endif
+
+/* Set to 1 to benchmark the pattern kernels at startup, which delays the
+ * first run and is reported on the result stream. */
+#ifndef SF3_KERNEL_BENCHMARK
+#define SF3_KERNEL_BENCHMARK 0
+#endif
+
+/* Set to 0 for the iterations started by a button to step through the device
+ * from its start, stopping at its end, rather than the wear record picking the
+ * region of each iteration for as long as the buttons are pressed. */
+#ifndef SF3_WEAR_SCHEDULE
+#define SF3_WEAR_SCHEDULE 1
+#endif
+
+/* Erase commands, selected from the size and alignment of the erase range. */
+enum SF3_ERASE_GRANULE_TAG {
+	SF3_ERASE_SUBSECTOR,
+	SF3_ERASE_SECTOR,
+	SF3_ERASE_DIE,
+	SF3_ERASE_BULK,
+	SF3_ERASE_NONE
+};
+
+/* Transfers requested of the SF3 transfer task. */
+enum SF3_XFER_TYPE_TAG {
+	SF3_XFER_PROGRAM,
+	SF3_XFER_READ,
+	SF3_XFER_NONE
+};
+
+/* Count of PmodSF3 instances in the hardware design, each one tested in
+ * parallel by its own SF3 and SF3X task pair. */
+#if defined(XPAR_PMODSF3_3_AXI_LITE_SPI_BASEADDR)
+#define SF3_DEVICE_COUNT 4
+#elif defined(XPAR_PMODSF3_2_AXI_LITE_SPI_BASEADDR)
+#define SF3_DEVICE_COUNT 3
+#elif defined(XPAR_PMODSF3_1_AXI_LITE_SPI_BASEADDR)
+#define SF3_DEVICE_COUNT 2
+#else
+#define SF3_DEVICE_COUNT 1
+#endif
+
+/* The count of transfer buffers in flight between the SF3 and transfer tasks,
+ * SF3_XFER_BUFFER_COUNT, is set by the board in sf3_board.h. */
+
+typedef struct SF3_XFER_TAG {
+	int xferType;
+	u32 address;
+	u32 byteCount;
+	u32 pageCount;
+	u8 command;
+	u8 dummyBytes;
+	u8* buffer;
+	XStatus statusWen;
+	XStatus status;
+	u32 latencyTicks;
+} t_sf3_xfer;
+
+typedef struct CLS_LINES_TAG {
+	char line1[17];
+	char line2[17];
+} t_cls_lines;
+
+void Experiment_prvSf3Task( void *pvParameters );
+void Experiment_prvSf3XferTask( void *pvParameters );
+const t_failmap* Experiment_GetFailMap(int deviceIndex);
+void Experiment_Sf3IntrHandler(void* callbackRef);
+
+#endif // _EXPERIMENT_H_
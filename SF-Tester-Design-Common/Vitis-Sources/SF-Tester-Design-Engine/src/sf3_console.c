@@ -0,0 +1,140 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_console.c
+ *
+ * @brief
+ * Transmit ring of the terminal console, written by the print task and sent
+ * by the interrupt of the board UART, so that the print task only blocks when
+ * the ring is full rather than on each byte of the UART FIFO.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <stdbool.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "sf3_board.h"
+#include "sf3_console.h"
+
+/* The ring is empty when the head equals the tail. The print task is the only
+ * writer of the head, and the UART interrupt the only writer of the tail. */
+static u8 consoleRing[SF3_CONSOLE_TX_RING_SZ];
+static volatile u32 consoleHead = 0;
+static volatile u32 consoleTail = 0;
+/* Bytes of the UART send in progress from the tail, or 0 when it is idle */
+static volatile u32 consoleSendLen = 0;
+/* Given by the UART interrupt as each send frees space in the ring */
+static SemaphoreHandle_t xConsoleSpace = NULL;
+static bool consoleIntrEnabled = false;
+
+/* Start the UART send of the bytes from the tail to the head or the end of
+ * the ring, if the UART is idle. Called with the UART interrupt masked. */
+static void Console_StartSend(void)
+{
+	const u32 head = consoleHead;
+	const u32 tail = consoleTail;
+
+	if ((consoleSendLen != 0) || (head == tail))
+		return;
+
+	consoleSendLen = (head > tail) ? (head - tail) : (SF3_CONSOLE_TX_RING_SZ - tail);
+	Board_ConsoleSend(&(consoleRing[tail]), consoleSendLen);
+}
+
+/* Start the interrupt-driven transmit of the board UART; without it, the
+ * console writes each byte to the UART with the polled output of the BSP. */
+void Console_Init(void)
+{
+	xConsoleSpace = xSemaphoreCreateBinary();
+	configASSERT(xConsoleSpace);
+
+	consoleIntrEnabled = (Board_ConsoleBegin() == XST_SUCCESS);
+}
+
+/* Copy the text to the ring and start its send, blocking only while the ring
+ * is full. Called by the print task alone. */
+void Console_Write(const char* text, u32 byteCount)
+{
+	u32 spaceCount;
+	u32 chunkCount;
+
+	if (! consoleIntrEnabled) {
+		for (u32 i = 0; i < byteCount; ++i) {
+			outbyte(text[i]);
+		}
+		return;
+	}
+
+	while (byteCount > 0) {
+		spaceCount = (consoleTail + SF3_CONSOLE_TX_RING_SZ - consoleHead - 1) % SF3_CONSOLE_TX_RING_SZ;
+
+		if (spaceCount == 0) {
+			/* The UART is sending, so its interrupt frees space. */
+			xSemaphoreTake(xConsoleSpace, portMAX_DELAY);
+			continue;
+		}
+
+		chunkCount = byteCount;
+		if (chunkCount > spaceCount)
+			chunkCount = spaceCount;
+		if (chunkCount > SF3_CONSOLE_TX_RING_SZ - consoleHead)
+			chunkCount = SF3_CONSOLE_TX_RING_SZ - consoleHead;
+
+		memcpy(&(consoleRing[consoleHead]), text, chunkCount);
+
+		taskENTER_CRITICAL();
+		consoleHead = (consoleHead + chunkCount) % SF3_CONSOLE_TX_RING_SZ;
+		Console_StartSend();
+		taskEXIT_CRITICAL();
+
+		text += chunkCount;
+		byteCount -= chunkCount;
+	}
+}
+
+/* Release the bytes of the completed UART send and start the next one; called
+ * by the board UART interrupt handler. */
+void Console_SendDone(void)
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	consoleTail = (consoleTail + consoleSendLen) % SF3_CONSOLE_TX_RING_SZ;
+	consoleSendLen = 0;
+	Console_StartSend();
+
+	xSemaphoreGiveFromISR(xConsoleSpace, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
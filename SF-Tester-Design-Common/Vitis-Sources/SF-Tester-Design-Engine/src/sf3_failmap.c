@@ -0,0 +1,128 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_failmap.c
+ *
+ * @brief
+ * Failure map of an SF3 test run: error counters and failing bits of each
+ * subsector, the failing bits of the whole run, and the address, expected and
+ * actual byte of the first failures. Pages are recorded only on the fail path.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "sf3_pattern.h"
+#include "sf3_failmap.h"
+
+#define FAILMAP_COUNT_MAX 0xFFFF
+
+/* Attach the subsector storage to the map and clear it. */
+void FailMap_Init(t_failmap* map, u16* subsectorErrCounts, u8* subsectorXorMasks,
+		u32 subsectorCount)
+{
+	map->subsectorErrCounts = subsectorErrCounts;
+	map->subsectorXorMasks = subsectorXorMasks;
+	map->subsectorCount = subsectorCount;
+	map->errCount = 1; /* force the clear of the subsector storage */
+	FailMap_Clear(map);
+}
+
+/* Clear the map for a new run; the subsector storage is only cleared after a
+ * run that recorded failures, so that passing runs cost nothing here. */
+void FailMap_Clear(t_failmap* map)
+{
+	if (map->errCount != 0) {
+		memset(map->subsectorErrCounts, 0x00, map->subsectorCount * sizeof(u16));
+		memset(map->subsectorXorMasks, 0x00, map->subsectorCount * sizeof(u8));
+	}
+
+	map->errCount = 0;
+	map->failSubsectorCount = 0;
+	map->xorMask = 0x00;
+	map->stuckHighMask = 0x00;
+	map->stuckLowMask = 0x00;
+	map->entryCount = 0;
+}
+
+/* Record the failing bytes of one page read back at the page address, and
+ * return the offset of the first of them, or the byte count when none fails.
+ * Only call for pages whose mismatch count is not zero.
+ */
+u32 FailMap_RecordPage(t_failmap* map, u32 pageAddr, const u8* actual,
+		const u8* expected, u32 byteCount)
+{
+	u32 first = Pattern_FindFirstMismatch(actual, expected, byteCount);
+	u32 iSub;
+	u8 diff;
+
+	for (u32 i = first; i < byteCount; ++i) {
+		diff = actual[i] ^ expected[i];
+		if (diff == 0x00)
+			continue;
+
+		iSub = (pageAddr + i) >> FAILMAP_SUBSECTOR_SHIFT;
+		if (iSub < map->subsectorCount) {
+			if (map->subsectorErrCounts[iSub] == 0)
+				map->failSubsectorCount++;
+			if (map->subsectorErrCounts[iSub] < FAILMAP_COUNT_MAX)
+				map->subsectorErrCounts[iSub]++;
+			map->subsectorXorMasks[iSub] |= diff;
+		}
+
+		map->errCount++;
+		map->xorMask |= diff;
+		map->stuckHighMask |= diff & actual[i];
+		map->stuckLowMask |= diff & expected[i];
+
+		if (map->entryCount < FAILMAP_ENTRY_COUNT) {
+			map->entries[map->entryCount].address = pageAddr + i;
+			map->entries[map->entryCount].expected = expected[i];
+			map->entries[map->entryCount].actual = actual[i];
+			map->entryCount++;
+		}
+	}
+
+	return first;
+}
+
+/* Return the index of the subsector with the most errors. */
+u32 FailMap_WorstSubsector(const t_failmap* map)
+{
+	u32 worst = 0;
+
+	for (u32 iSub = 1; iSub < map->subsectorCount; ++iSub) {
+		if (map->subsectorErrCounts[iSub] > map->subsectorErrCounts[worst])
+			worst = iSub;
+	}
+
+	return worst;
+}
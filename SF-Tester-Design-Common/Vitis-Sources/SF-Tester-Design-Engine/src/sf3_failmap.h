@@ -0,0 +1,82 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_failmap.h
+ *
+ * @brief
+ * Failure map of an SF3 test run: error counters and failing bits of each
+ * subsector, the failing bits of the whole run, and the address, expected and
+ * actual byte of the first failures. Pages are recorded only on the fail path.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_SF3_FAILMAP_H_
+#define SRC_SF3_FAILMAP_H_
+
+#include "xil_types.h"
+
+/* Count of first failing bytes kept with their address and contents. */
+#define FAILMAP_ENTRY_COUNT 16
+
+/* Subsector size of the N25Q, the granularity of the error counters. */
+#define FAILMAP_SUBSECTOR_SHIFT 12
+
+/* One failing byte of the run. */
+typedef struct FAILMAP_ENTRY_TAG {
+	u32 address;
+	u8 expected;
+	u8 actual;
+} t_failmap_entry;
+
+/* Failure map of one test run, with subsector counters and masks stored in
+ * arrays provided by the caller, one element per subsector of the device. */
+typedef struct FAILMAP_TAG {
+	u16* subsectorErrCounts; /* saturating */
+	u8* subsectorXorMasks;   /* OR of actual XOR expected */
+	u32 subsectorCount;
+	u32 errCount;
+	u32 failSubsectorCount;
+	u8 xorMask;       /* bits that read different from expected */
+	u8 stuckHighMask; /* bits that read 1 where 0 was expected */
+	u8 stuckLowMask;  /* bits that read 0 where 1 was expected */
+	u32 entryCount;
+	t_failmap_entry entries[FAILMAP_ENTRY_COUNT];
+} t_failmap;
+
+void FailMap_Init(t_failmap* map, u16* subsectorErrCounts, u8* subsectorXorMasks,
+		u32 subsectorCount);
+void FailMap_Clear(t_failmap* map);
+u32 FailMap_RecordPage(t_failmap* map, u32 pageAddr, const u8* actual,
+		const u8* expected, u32 byteCount);
+u32 FailMap_WorstSubsector(const t_failmap* map);
+
+#endif /* SRC_SF3_FAILMAP_H_ */
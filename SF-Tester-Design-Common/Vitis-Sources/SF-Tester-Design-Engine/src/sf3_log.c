@@ -0,0 +1,300 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_log.c
+ *
+ * @brief
+ * Lock-free terminal log of binary event records, one single-producer ring
+ * per logging task, formatted to text lazily by the print task.
+ *
+ * A producer reserves the record at the head of its ring, fills it in place
+ * and commits it, then notifies the print task. Only the producer writes the
+ * head index and only the print task writes the tail index. A full ring drops
+ * the record and counts it, and the print task reports the count of records
+ * lost.
+ *
+ * The result stream records are CSV lines for host-side analysis, starting
+ * with '$' and ending with '*' and the hexadecimal XOR of the characters in
+ * between, in the manner of NMEA sentences; fields are hexadecimal except for
+ * the counts. Host scripts select the lines starting with "$SF3".
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include "sf3_log.h"
+
+/* Keep the compiler from moving the record accesses across the index update. */
+#define LOG_COMPILER_BARRIER() __asm__ volatile ("" ::: "memory")
+
+typedef struct LOG_RING_DESC_TAG {
+	volatile u32 head;
+	volatile u32 tail;
+	volatile u32 dropCount;
+	u32 dropReported;
+	t_log_record records[LOG_RING_RECORD_COUNT];
+} t_log_ring;
+
+static t_log_ring logRings[LOG_SOURCE_COUNT];
+static TaskHandle_t xLogConsumer = NULL;
+static int logNextSource = 0;
+
+/* Set the print task notified of each committed record. */
+void Log_Init(TaskHandle_t xConsumerTask)
+{
+	xLogConsumer = xConsumerTask;
+}
+
+/* Reserve the next record of the ring of the source, waiting up to the given
+ * ticks for the print task to free one; returns NULL and counts the record as
+ * lost when the ring stays full. */
+t_log_record* Log_Reserve(int source, TickType_t xTicksToWait)
+{
+	t_log_ring* ring = &(logRings[source]);
+	const TickType_t xStartTime = xTaskGetTickCount();
+	t_log_record* record;
+
+	while ((ring->head - ring->tail) >= LOG_RING_RECORD_COUNT) {
+		if ((xTaskGetTickCount() - xStartTime) >= xTicksToWait) {
+			ring->dropCount++;
+			return NULL;
+		}
+		vTaskDelay(1);
+	}
+
+	record = &(ring->records[ring->head % LOG_RING_RECORD_COUNT]);
+	record->source = (u8) source;
+	return record;
+}
+
+/* Publish the record reserved last by the source, and wake the print task. */
+void Log_Commit(int source)
+{
+	t_log_ring* ring = &(logRings[source]);
+
+	LOG_COMPILER_BARRIER();
+	ring->head = ring->head + 1;
+
+	if (xLogConsumer != NULL) {
+		xTaskNotifyGive(xLogConsumer);
+	}
+}
+
+/* Log one binary event without waiting, for use in the hot loops. */
+void Log_Event(int source, int eventId, UINTPTR arg0, UINTPTR arg1,
+		UINTPTR arg2, UINTPTR arg3)
+{
+	t_log_record* record = Log_Reserve(source, 0);
+
+	if (record == NULL) {
+		return;
+	}
+
+	record->eventId = (u8) eventId;
+	record->args[0] = arg0;
+	record->args[1] = arg1;
+	record->args[2] = arg2;
+	record->args[3] = arg3;
+	Log_Commit(source);
+}
+
+/* Format one result stream record, appending its checksum. */
+static void Log_FormatStream(const t_log_record* record, char* line, u32 lineSize)
+{
+	const UINTPTR* args = record->args;
+	u8 checksum = 0;
+	int len;
+
+	switch (record->eventId) {
+	case LOG_EVENT_STREAM_ITER:
+		len = snprintf(line, lineSize, "$SF3I,%u,%lx,%lx,%c,%lu", record->source,
+				(unsigned long) args[0], (unsigned long) args[1], (char) args[2],
+				(unsigned long) args[3]);
+		break;
+	case LOG_EVENT_STREAM_FAIL:
+		len = snprintf(line, lineSize, "$SF3F,%u,%lx,%02lx", record->source,
+				(unsigned long) args[0], (unsigned long) args[1]);
+		break;
+	case LOG_EVENT_STREAM_PHASE:
+		len = snprintf(line, lineSize, "$SF3T,%u,%s,%lu,%lu,%lu", record->source,
+				(const char*) args[0], (unsigned long) args[1], (unsigned long) args[2],
+				(unsigned long) args[3]);
+		break;
+	case LOG_EVENT_STREAM_KERNEL:
+		len = snprintf(line, lineSize, "$SF3K,%u,%s,%lu,%lu", record->source,
+				(const char*) args[0], (unsigned long) args[1], (unsigned long) args[2]);
+		break;
+	case LOG_EVENT_STREAM_SWEEP:
+	default:
+		len = snprintf(line, lineSize, "$SF3S,%u,%lx,%lu", record->source,
+				(unsigned long) args[0], (unsigned long) args[1]);
+		break;
+	}
+
+	if ((len < 0) || ((u32) len + 4 > lineSize)) {
+		return;
+	}
+
+	for (int i = 1; i < len; ++i) {
+		checksum ^= (u8) line[i];
+	}
+	snprintf(&(line[len]), lineSize - len, "*%02X", checksum);
+}
+
+/* Format one committed record as a terminal line, with the device index in
+ * front of the events of a device when testing more than one device. */
+static void Log_FormatRecord(const t_log_record* record, char* line, u32 lineSize)
+{
+	const UINTPTR* args = record->args;
+	int len = 0;
+
+	if (record->eventId == LOG_EVENT_TEXT) {
+		snprintf(line, lineSize, "%s", record->text);
+		return;
+	}
+
+	if (record->eventId >= LOG_EVENT_STREAM_ITER) {
+		Log_FormatStream(record, line, lineSize);
+		return;
+	}
+
+	if ((SF3_DEVICE_COUNT > 1) && (record->source < SF3_DEVICE_COUNT)) {
+		len = snprintf(line, lineSize, "%d ", record->source);
+	}
+
+	line += len;
+	lineSize -= len;
+
+	switch (record->eventId) {
+	case LOG_EVENT_SF3_FAIL:
+		snprintf(line, lineSize, "SF3 init Fail %ld", (long) args[0]);
+		break;
+	case LOG_EVENT_WEN_FAIL:
+		snprintf(line, lineSize, "WEN Fail");
+		break;
+	case LOG_EVENT_ERS_FAIL:
+		snprintf(line, lineSize, "Ers Fail %08lx", (unsigned long) args[0]);
+		break;
+	case LOG_EVENT_ERS_TIMEOUT:
+		snprintf(line, lineSize, "Ers Tout %08lx", (unsigned long) args[0]);
+		break;
+	case LOG_EVENT_PRO_FAIL:
+		snprintf(line, lineSize, "PRO Fail %08lx", (unsigned long) args[0]);
+		break;
+	case LOG_EVENT_RD_FAIL:
+		snprintf(line, lineSize, "RD  Fail %08lx", (unsigned long) args[0]);
+		break;
+	case LOG_EVENT_FSR_FAIL:
+		snprintf(line, lineSize, "FSR Fail");
+		break;
+	case LOG_EVENT_FSR_ERR:
+		snprintf(line, lineSize, "FSR Err %02lx", (unsigned long) args[0]);
+		break;
+	case LOG_EVENT_HDR_FAIL:
+		snprintf(line, lineSize, "HDR Fail %08lx", (unsigned long) args[0]);
+		break;
+	case LOG_EVENT_HDR_NONE:
+		snprintf(line, lineSize, "HDR none, no run to verify");
+		break;
+	case LOG_EVENT_HDR_ERASE:
+		snprintf(line, lineSize, "HDR Erase %08lx ers %lu", (unsigned long) args[0],
+				(unsigned long) args[1]);
+		break;
+	case LOG_EVENT_DEV_RESULT:
+		snprintf(line, lineSize, "%s ERR %08lu", args[0] ? "PASS" : "FAIL",
+				(unsigned long) args[1]);
+		break;
+	case LOG_EVENT_SWEEP:
+		snprintf(line, lineSize, "SWP %lu KiB ERR %lu", (unsigned long) args[0],
+				(unsigned long) args[1]);
+		break;
+	case LOG_EVENT_PHASE_RATE:
+		snprintf(line, lineSize, "%s %lu.%03lu MB/s %lu cmd", (const char*) args[0],
+				(unsigned long) (args[1] / 1000), (unsigned long) (args[1] % 1000),
+				(unsigned long) args[2]);
+		break;
+	case LOG_EVENT_PHASE_US:
+		snprintf(line, lineSize, "%s us %lu/%lu/%lu", (const char*) args[0],
+				(unsigned long) args[1], (unsigned long) args[2], (unsigned long) args[3]);
+		break;
+	case LOG_EVENT_FMAP_SUB:
+		snprintf(line, lineSize, "MAP %lu sub max %08lx %lu", (unsigned long) args[0],
+				(unsigned long) args[1], (unsigned long) args[2]);
+		break;
+	case LOG_EVENT_FMAP_BITS:
+		snprintf(line, lineSize, "MAP bits %02lx hi %02lx lo %02lx", (unsigned long) args[0],
+				(unsigned long) args[1], (unsigned long) args[2]);
+		break;
+	case LOG_EVENT_FMAP_ENTRY:
+		snprintf(line, lineSize, "MAP %08lx %02lx>%02lx", (unsigned long) args[0],
+				(unsigned long) args[1], (unsigned long) args[2]);
+		break;
+	case LOG_EVENT_WEAR:
+		snprintf(line, lineSize, "WEAR %08lx ers %lu min %lu cov %lu", (unsigned long) args[0],
+				(unsigned long) args[1], (unsigned long) args[2], (unsigned long) args[3]);
+		break;
+	default:
+		snprintf(line, lineSize, "LOG event %u", record->eventId);
+		break;
+	}
+}
+
+/* Format the next pending line, taking the rings in turn; a count of lost
+ * records is reported ahead of the rest of its ring. Returns false when no
+ * record is pending. */
+bool Log_FormatNext(char* line, u32 lineSize)
+{
+	for (int iRing = 0; iRing < LOG_SOURCE_COUNT; ++iRing) {
+		const int source = (logNextSource + iRing) % LOG_SOURCE_COUNT;
+		t_log_ring* ring = &(logRings[source]);
+		const u32 dropCount = ring->dropCount;
+		const u32 tail = ring->tail;
+
+		if (dropCount != ring->dropReported) {
+			snprintf(line, lineSize, "LOG %d lost %lu", source,
+					(unsigned long) (dropCount - ring->dropReported));
+			ring->dropReported = dropCount;
+			logNextSource = source;
+			return true;
+		}
+
+		if (ring->head != tail) {
+			LOG_COMPILER_BARRIER();
+			Log_FormatRecord(&(ring->records[tail % LOG_RING_RECORD_COUNT]), line, lineSize);
+			LOG_COMPILER_BARRIER();
+			ring->tail = tail + 1;
+			logNextSource = (source + 1) % LOG_SOURCE_COUNT;
+			return true;
+		}
+	}
+
+	return false;
+}
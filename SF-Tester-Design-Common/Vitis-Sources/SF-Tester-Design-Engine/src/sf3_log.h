@@ -0,0 +1,111 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_log.h
+ *
+ * @brief
+ * Lock-free terminal log of binary event records, one single-producer ring
+ * per logging task, formatted to text lazily by the print task.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_SF3_LOG_H_
+#define SRC_SF3_LOG_H_
+
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "xil_types.h"
+#include "Experiment.h"
+
+/* Log sources, each the only task producing into its ring: one per SF3
+ * device task, the CLS task, and the relay of the Zynq dual-core split. */
+#define LOG_SOURCE_DISPLAY (SF3_DEVICE_COUNT)
+#define LOG_SOURCE_RELAY (SF3_DEVICE_COUNT + 1)
+#define LOG_SOURCE_COUNT (SF3_DEVICE_COUNT + 2)
+
+/* Records per ring, a power of two. */
+#define LOG_RING_RECORD_COUNT 32
+
+#define LOG_ARG_COUNT 4
+
+/* Longest formatted line of the log, including the result stream records. */
+#define LOG_LINE_SZ 48
+
+/* Log events; each names its arguments in order. */
+enum LOG_EVENT_TAG {
+	LOG_EVENT_TEXT,         /* text, preformatted */
+	LOG_EVENT_SF3_FAIL,     /* status */
+	LOG_EVENT_WEN_FAIL,     /* none */
+	LOG_EVENT_ERS_FAIL,     /* address */
+	LOG_EVENT_ERS_TIMEOUT,  /* address */
+	LOG_EVENT_PRO_FAIL,     /* address */
+	LOG_EVENT_RD_FAIL,      /* address */
+	LOG_EVENT_FSR_FAIL,     /* none */
+	LOG_EVENT_FSR_ERR,      /* flag status */
+	LOG_EVENT_HDR_FAIL,     /* address */
+	LOG_EVENT_HDR_NONE,
+	LOG_EVENT_HDR_ERASE,    /* address, erase count */
+	LOG_EVENT_DEV_RESULT,   /* pass, error count */
+	LOG_EVENT_SWEEP,        /* KiB, error count */
+	LOG_EVENT_PHASE_RATE,   /* label, KB/s, command count */
+	LOG_EVENT_PHASE_US,     /* label, minimum, average, maximum us */
+	LOG_EVENT_FMAP_SUB,     /* failing subsectors, worst address, its errors */
+	LOG_EVENT_FMAP_BITS,    /* XOR mask, stuck-high mask, stuck-low mask */
+	LOG_EVENT_FMAP_ENTRY,   /* address, expected byte, actual byte */
+	LOG_EVENT_WEAR,         /* region address, its erases, least erases, regions covered */
+	/* Result stream records, "$SF3<kind>,<device>,<fields>*<checksum>" */
+	LOG_EVENT_STREAM_ITER,  /* address, byte count, pattern, error count */
+	LOG_EVENT_STREAM_FAIL,  /* address, XOR of actual and expected byte */
+	LOG_EVENT_STREAM_PHASE, /* label, elapsed us, KB/s, command count */
+	LOG_EVENT_STREAM_SWEEP, /* byte count, error count */
+	LOG_EVENT_STREAM_KERNEL, /* label, CPU cycles per page, KB/s */
+	LOG_EVENT_NONE
+};
+
+typedef struct LOG_RECORD_TAG {
+	u8 eventId;
+	u8 source;
+	union {
+		UINTPTR args[LOG_ARG_COUNT];
+		char text[LOG_LINE_SZ];
+	};
+} t_log_record;
+
+void Log_Init(TaskHandle_t xConsumerTask);
+t_log_record* Log_Reserve(int source, TickType_t xTicksToWait);
+void Log_Commit(int source);
+void Log_Event(int source, int eventId, UINTPTR arg0, UINTPTR arg1,
+		UINTPTR arg2, UINTPTR arg3);
+bool Log_FormatNext(char* line, u32 lineSize);
+
+#endif /* SRC_SF3_LOG_H_ */
@@ -0,0 +1,218 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_n25q.c
+ *
+ * @brief
+ * N25Q serial flash register commands not provided by the PmodSF3 driver,
+ * and the 4-byte address memory commands of the HDL driver, issued through
+ * the PmodSF3 driver transfer functions.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "sf3_n25q.h"
+
+#if N25Q_ADDR_4BYTE
+#define N25Q_SUBSECTOR_ERASE_CMD N25Q_COMMAND_SUBSECTOR_ERASE_4BYTE
+#define N25Q_SECTOR_ERASE_CMD N25Q_COMMAND_SECTOR_ERASE_4BYTE
+#else
+#define N25Q_SUBSECTOR_ERASE_CMD N25Q_COMMAND_SUBSECTOR_ERASE
+#define N25Q_SECTOR_ERASE_CMD N25Q_COMMAND_SECTOR_ERASE
+#endif
+
+/* Helper function to read a one-byte N25Q register. The N25Q outputs the
+ * register repeatedly for as long as chip select is held, so the register
+ * read is issued as a one-byte SF3_FlashRead() of a command that has no dummy
+ * cycles; the address bytes shifted out are ignored by the flash.
+ */
+static XStatus N25Q_ReadRegister(PmodSF3* InstancePtr, u8 ReadCmd, u8* ValuePtr)
+{
+	u8 Buffer[SF3_READ_MIN_EXTRA_BYTES + 1];
+	u8* BufferPtr = &(Buffer[0]);
+	XStatus Status;
+
+	Buffer[SF3_READ_MIN_EXTRA_BYTES] = 0x00;
+
+	Status = SF3_FlashRead(InstancePtr, 0x00000000, 1, ReadCmd, &(BufferPtr));
+
+	*ValuePtr = Buffer[SF3_READ_MIN_EXTRA_BYTES];
+
+	return Status;
+}
+
+/* Helper function to split a memory address into the address field of the
+ * PmodSF3 driver, which frames each command with three address bytes, and
+ * the bytes following them in the buffer. For a 4-byte address, the upper
+ * three bytes go in the driver's address field and the low byte leads the
+ * data that follows the driver's header of HeaderBytes.
+ */
+static u32 N25Q_SplitAddress(u8* Buffer, u32 HeaderBytes, u32 Addr)
+{
+#if N25Q_ADDR_4BYTE
+	Buffer[HeaderBytes] = (u8)(Addr & 0xFF);
+	return Addr >> 8;
+#else
+	(void) Buffer;
+	(void) HeaderBytes;
+	return Addr;
+#endif
+}
+
+/* Helper function to issue an erase command with an address and no data,
+ * as a zero-length N25Q_FlashWrite() of the erase command. The caller must
+ * first issue SF3_FlashWriteEnable().
+ */
+static XStatus N25Q_EraseAtAddress(PmodSF3* InstancePtr, u8 EraseCmd, u32 Addr)
+{
+	u8 Buffer[N25Q_WRITE_EXTRA_BYTES];
+	u8* BufferPtr = &(Buffer[0]);
+
+	return N25Q_FlashWrite(InstancePtr, Addr, 0, EraseCmd, &(BufferPtr));
+}
+
+XStatus N25Q_ReadStatus(PmodSF3* InstancePtr, u8* StatusPtr)
+{
+	return N25Q_ReadRegister(InstancePtr, N25Q_COMMAND_READ_STATUS_REG, StatusPtr);
+}
+
+XStatus N25Q_ReadFlagStatus(PmodSF3* InstancePtr, u8* FlagStatusPtr)
+{
+	return N25Q_ReadRegister(InstancePtr, N25Q_COMMAND_READ_FLAG_STATUS_REG, FlagStatusPtr);
+}
+
+bool N25Q_IsBusy(PmodSF3* InstancePtr)
+{
+	u8 StatusReg = 0x00;
+
+	if (N25Q_ReadStatus(InstancePtr, &StatusReg) != XST_SUCCESS) {
+		return true;
+	}
+
+	return (StatusReg & N25Q_STATUS_WIP_MASK) ? true : false;
+}
+
+/* Indicate that N25Q_FlashRead() issues a dual or quad read command as the
+ * single lane read 0x13, which it does above the reach of a 3-byte address
+ * unless N25Q_ADDR_4BYTE_MULTI_IO is set, so that such a read can be timed
+ * apart from those of the selected engine.
+ */
+bool N25Q_IsReadFallback(u32 Addr, u32 ByteCount, u8 ReadCmd)
+{
+#if N25Q_ADDR_4BYTE && (! N25Q_ADDR_4BYTE_MULTI_IO)
+	return ((ReadCmd != N25Q_READ_CMD) && (Addr + ByteCount > N25Q_ADDR_3BYTE_LIMIT));
+#else
+	return false;
+#endif
+}
+
+XStatus N25Q_SubsectorErase(PmodSF3* InstancePtr, u32 Addr)
+{
+	return N25Q_EraseAtAddress(InstancePtr, N25Q_SUBSECTOR_ERASE_CMD, Addr);
+}
+
+XStatus N25Q_SectorErase(PmodSF3* InstancePtr, u32 Addr)
+{
+	return N25Q_EraseAtAddress(InstancePtr, N25Q_SECTOR_ERASE_CMD, Addr);
+}
+
+/* The die erase command has only a 3-byte address, so it is issued through
+ * the PmodSF3 driver framing, and only reaches a die below 16 MiB.
+ */
+XStatus N25Q_DieErase(PmodSF3* InstancePtr, u32 Addr)
+{
+	u8 Buffer[SF3_WRITE_EXTRA_BYTES];
+	u8* BufferPtr = &(Buffer[0]);
+
+	return SF3_FlashWrite(InstancePtr, Addr, 0, N25Q_COMMAND_DIE_ERASE, &(BufferPtr));
+}
+
+/* The bulk erase command carries no address, and the N25Q only executes it if
+ * chip select rises right after the command byte, so it is issued by the
+ * PmodSF3 driver. The address parameter is unused.
+ */
+XStatus N25Q_BulkErase(PmodSF3* InstancePtr, u32 Addr)
+{
+	return SF3_BulkErase(InstancePtr);
+}
+
+/* Write the data that follows the first N25Q_WRITE_EXTRA_BYTES of the buffer
+ * with a program or erase command of the selected address mode. The caller
+ * must first issue SF3_FlashWriteEnable().
+ */
+XStatus N25Q_FlashWrite(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 WriteCmd,
+		u8** BufferPtr)
+{
+	u32 DriverAddr = N25Q_SplitAddress(*BufferPtr, SF3_WRITE_EXTRA_BYTES, Addr);
+
+	return SF3_FlashWrite(InstancePtr, DriverAddr, ByteCount + N25Q_ADDR_EXTRA_BYTES,
+			WriteCmd, BufferPtr);
+}
+
+/* Read into the buffer, after its first N25Q_READ_EXTRA_BYTES and the dummy
+ * bytes of the read command, with a read command of the selected address
+ * mode. The PmodSF3 driver appends the dummy bytes of its own 3-byte address
+ * commands; the dummy bytes of the 4-byte address commands are appended here.
+ */
+XStatus N25Q_FlashRead(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 ReadCmd,
+		u32 DummyBytes, u8** BufferPtr)
+{
+#if N25Q_ADDR_4BYTE && (! N25Q_ADDR_4BYTE_MULTI_IO)
+	/* The dual and quad reads are the 3-byte address commands of the driver,
+	 * framed later in the buffer by the address byte the 4-byte commands add,
+	 * so that the data lands at the same offset. Above the reach of a 3-byte
+	 * address, the single lane read is framed later by the dummy bytes instead.
+	 */
+	if (ReadCmd != N25Q_READ_CMD) {
+		u8* DriverBufferPtr;
+
+		if (! N25Q_IsReadFallback(Addr, ByteCount, ReadCmd)) {
+			DriverBufferPtr = &((*BufferPtr)[N25Q_ADDR_EXTRA_BYTES]);
+			return SF3_FlashRead(InstancePtr, Addr, ByteCount, ReadCmd, &(DriverBufferPtr));
+		}
+
+		DriverBufferPtr = &((*BufferPtr)[DummyBytes]);
+		return N25Q_FlashRead(InstancePtr, Addr, ByteCount, N25Q_READ_CMD, 0, &(DriverBufferPtr));
+	}
+#endif
+
+	u32 DriverAddr = N25Q_SplitAddress(*BufferPtr, SF3_READ_MIN_EXTRA_BYTES, Addr);
+
+#if N25Q_ADDR_4BYTE
+	memset(&((*BufferPtr)[N25Q_READ_EXTRA_BYTES]), 0xFF, DummyBytes);
+	ByteCount += N25Q_ADDR_EXTRA_BYTES + DummyBytes;
+#else
+	(void) DummyBytes;
+#endif
+
+	return SF3_FlashRead(InstancePtr, DriverAddr, ByteCount, ReadCmd, BufferPtr);
+}
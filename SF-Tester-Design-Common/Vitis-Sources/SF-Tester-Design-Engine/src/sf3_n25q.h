@@ -0,0 +1,166 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_n25q.h
+ *
+ * @brief
+ * N25Q serial flash register commands not provided by the PmodSF3 driver,
+ * and the 4-byte address memory commands of the HDL driver, issued through
+ * the PmodSF3 driver transfer functions.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_SF3_N25Q_H_
+#define SRC_SF3_N25Q_H_
+
+#include <stdbool.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "PmodSF3.h"
+
+/* Set to 0 to address the N25Q with the 3-byte address commands of the PmodSF3
+ * driver, which reach only the first 16 MiB of the device. */
+#ifndef N25Q_ADDR_4BYTE
+#define N25Q_ADDR_4BYTE 1
+#endif
+
+/* Set to 1 to also issue the dual and quad reads with their 4-byte address
+ * commands. The AXI Quad SPI of the PmodSF3 IP switches the lanes of a dual or
+ * quad command from its opcode, so this requires the IP to be configured for
+ * the Micron memory with a 32-bit address (C_SPI_MEM_ADDR_BITS of 32), and to
+ * accept the opcodes 0x3C, 0xBC, 0x6C and 0xEC; neither is verified on the
+ * board. By default, the dual and quad reads are the 3-byte address commands
+ * of the PmodSF3 driver below 16 MiB, and the single lane read 0x13 above. */
+#ifndef N25Q_ADDR_4BYTE_MULTI_IO
+#define N25Q_ADDR_4BYTE_MULTI_IO 0
+#endif
+
+/* Set to 1 to program the pages with the quad input fast program, 0x34 with a
+ * 4-byte address or 0x32 with a 3-byte address, instead of the single lane
+ * page program. As for the 4-byte dual and quad reads, the 4-byte command
+ * requires N25Q_ADDR_4BYTE_MULTI_IO and the IP to accept its opcode; the quad
+ * program is not verified on the board. */
+#ifndef N25Q_QUAD_PROGRAM
+#define N25Q_QUAD_PROGRAM 0
+#endif
+
+#if N25Q_QUAD_PROGRAM && N25Q_ADDR_4BYTE && (! N25Q_ADDR_4BYTE_MULTI_IO)
+#error "N25Q_QUAD_PROGRAM with N25Q_ADDR_4BYTE requires N25Q_ADDR_4BYTE_MULTI_IO"
+#endif
+
+#define N25Q_COMMAND_READ_STATUS_REG 0x05
+#define N25Q_COMMAND_READ_FLAG_STATUS_REG 0x70
+#define N25Q_COMMAND_SUBSECTOR_ERASE 0x20
+#define N25Q_COMMAND_SECTOR_ERASE 0xD8
+#define N25Q_COMMAND_DIE_ERASE 0xC4
+#define N25Q_COMMAND_QUAD_INPUT_PROGRAM 0x32
+
+/* Memory commands with a 4-byte address, as used by the HDL driver; these
+ * need neither the extended address register nor 4-byte address mode. */
+#define N25Q_COMMAND_READ_4BYTE 0x13
+#define N25Q_COMMAND_DUAL_OUTPUT_READ_4BYTE 0x3C
+#define N25Q_COMMAND_DUAL_IO_READ_4BYTE 0xBC
+#define N25Q_COMMAND_QUAD_OUTPUT_READ_4BYTE 0x6C
+#define N25Q_COMMAND_QUAD_IO_READ_4BYTE 0xEC
+#define N25Q_COMMAND_PAGE_PROGRAM_4BYTE 0x12
+#define N25Q_COMMAND_QUAD_INPUT_PROGRAM_4BYTE 0x34
+#define N25Q_COMMAND_SUBSECTOR_ERASE_4BYTE 0x21
+#define N25Q_COMMAND_SECTOR_ERASE_4BYTE 0xDC
+
+/* Memory commands and buffer header sizes of the selected address mode; the
+ * buffers of N25Q_FlashWrite() and N25Q_FlashRead() hold the command and
+ * address in the first N25Q_WRITE_EXTRA_BYTES or N25Q_READ_EXTRA_BYTES. */
+#if N25Q_ADDR_4BYTE
+#define N25Q_ADDR_EXTRA_BYTES 1
+#define N25Q_READ_CMD N25Q_COMMAND_READ_4BYTE
+#if N25Q_ADDR_4BYTE_MULTI_IO
+#define N25Q_DUAL_OUTPUT_READ_CMD N25Q_COMMAND_DUAL_OUTPUT_READ_4BYTE
+#define N25Q_DUAL_IO_READ_CMD N25Q_COMMAND_DUAL_IO_READ_4BYTE
+#define N25Q_QUAD_OUTPUT_READ_CMD N25Q_COMMAND_QUAD_OUTPUT_READ_4BYTE
+#define N25Q_QUAD_IO_READ_CMD N25Q_COMMAND_QUAD_IO_READ_4BYTE
+#else
+#define N25Q_DUAL_OUTPUT_READ_CMD SF3_COMMAND_DUAL_READ
+#define N25Q_DUAL_IO_READ_CMD SF3_COMMAND_DUAL_IO_READ
+#define N25Q_QUAD_OUTPUT_READ_CMD SF3_COMMAND_QUAD_READ
+#define N25Q_QUAD_IO_READ_CMD SF3_COMMAND_QUAD_IO_READ
+#endif
+#if N25Q_QUAD_PROGRAM
+#define N25Q_PAGE_PROGRAM_CMD N25Q_COMMAND_QUAD_INPUT_PROGRAM_4BYTE
+#else
+#define N25Q_PAGE_PROGRAM_CMD N25Q_COMMAND_PAGE_PROGRAM_4BYTE
+#endif
+#else
+#define N25Q_ADDR_EXTRA_BYTES 0
+#define N25Q_READ_CMD SF3_COMMAND_RANDOM_READ
+#define N25Q_DUAL_OUTPUT_READ_CMD SF3_COMMAND_DUAL_READ
+#define N25Q_DUAL_IO_READ_CMD SF3_COMMAND_DUAL_IO_READ
+#define N25Q_QUAD_OUTPUT_READ_CMD SF3_COMMAND_QUAD_READ
+#define N25Q_QUAD_IO_READ_CMD SF3_COMMAND_QUAD_IO_READ
+#if N25Q_QUAD_PROGRAM
+#define N25Q_PAGE_PROGRAM_CMD N25Q_COMMAND_QUAD_INPUT_PROGRAM
+#else
+#define N25Q_PAGE_PROGRAM_CMD SF3_COMMAND_PAGE_PROGRAM
+#endif
+#endif
+#define N25Q_WRITE_EXTRA_BYTES (SF3_WRITE_EXTRA_BYTES + N25Q_ADDR_EXTRA_BYTES)
+#define N25Q_READ_EXTRA_BYTES (SF3_READ_MIN_EXTRA_BYTES + N25Q_ADDR_EXTRA_BYTES)
+
+/* Addresses reachable by the commands that only have a 3-byte address. */
+#define N25Q_ADDR_3BYTE_LIMIT 0x01000000
+
+#define N25Q_SUBSECTOR_SIZE 4096
+#define N25Q_SECTOR_SIZE 65536
+#define N25Q_DIE_SIZE 33554432
+
+#define N25Q_STATUS_WIP_MASK 0x01
+
+#define N25Q_FLAG_STATUS_READY_MASK 0x80
+#define N25Q_FLAG_STATUS_ERASE_ERR_MASK 0x20
+#define N25Q_FLAG_STATUS_PROGRAM_ERR_MASK 0x10
+#define N25Q_FLAG_STATUS_PROTECT_ERR_MASK 0x02
+#define N25Q_FLAG_STATUS_ERR_MASK (N25Q_FLAG_STATUS_ERASE_ERR_MASK | \
+		N25Q_FLAG_STATUS_PROGRAM_ERR_MASK | N25Q_FLAG_STATUS_PROTECT_ERR_MASK)
+
+XStatus N25Q_ReadStatus(PmodSF3* InstancePtr, u8* StatusPtr);
+XStatus N25Q_ReadFlagStatus(PmodSF3* InstancePtr, u8* FlagStatusPtr);
+bool N25Q_IsBusy(PmodSF3* InstancePtr);
+bool N25Q_IsReadFallback(u32 Addr, u32 ByteCount, u8 ReadCmd);
+XStatus N25Q_SubsectorErase(PmodSF3* InstancePtr, u32 Addr);
+XStatus N25Q_SectorErase(PmodSF3* InstancePtr, u32 Addr);
+XStatus N25Q_DieErase(PmodSF3* InstancePtr, u32 Addr);
+XStatus N25Q_BulkErase(PmodSF3* InstancePtr, u32 Addr);
+XStatus N25Q_FlashWrite(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 WriteCmd,
+		u8** BufferPtr);
+XStatus N25Q_FlashRead(PmodSF3* InstancePtr, u32 Addr, u32 ByteCount, u8 ReadCmd,
+		u32 DummyBytes, u8** BufferPtr);
+
+#endif /* SRC_SF3_N25Q_H_ */
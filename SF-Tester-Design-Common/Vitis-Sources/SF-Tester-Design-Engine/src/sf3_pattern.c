@@ -0,0 +1,296 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_pattern.c
+ *
+ * @brief
+ * Test pattern kernels that generate and compare the arithmetic byte sequence
+ * of a test pattern four bytes at a time, with byte-exact reference versions,
+ * compare against a precomputed image of the pattern, and generate the
+ * address-dependent page patterns, each seeded directly from the page address.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "sf3_pattern.h"
+
+#define PATTERN_LANES_LOW_MASK ((u32)0x7F7F7F7F)
+#define PATTERN_LANES_HIGH_MASK ((u32)0x80808080)
+#define PATTERN_LANES_ONES ((u32)0x01010101)
+#define PATTERN_PAGE_SIZE 256
+#define PATTERN_PRBS31_MASK ((u32)0x7FFFFFFF)
+#define PATTERN_PRBS31_SEED_XOR ((u32)0x5F3759DF)
+
+/* Helper function to add each of the four byte lanes of two words, modulo 256
+ * per lane, so that no carry crosses into the neighboring byte.
+ */
+static inline u32 Pattern_LanesAdd(u32 a, u32 b)
+{
+	return ((a & PATTERN_LANES_LOW_MASK) + (b & PATTERN_LANES_LOW_MASK)) ^
+			((a ^ b) & PATTERN_LANES_HIGH_MASK);
+}
+
+/* Helper function to count the non-zero byte lanes of a word, by folding each
+ * lane onto its low bit and summing the four low bits into the top lane.
+ */
+static inline u32 Pattern_LanesNonZeroCount(u32 x)
+{
+	x |= x >> 4;
+	x |= x >> 2;
+	x |= x >> 1;
+	x &= PATTERN_LANES_ONES;
+
+	return (x * PATTERN_LANES_ONES) >> 24;
+}
+
+/* Helper function to pack the first four bytes of the sequence into a word, in
+ * memory order, so that the kernels are independent of the CPU endianness.
+ */
+static inline u32 Pattern_FirstWord(u8 startVal, u8 incrVal)
+{
+	u8 bytes[sizeof(u32)];
+	u32 word;
+
+	for (u32 i = 0; i < sizeof(u32); ++i) {
+		bytes[i] = startVal;
+		startVal += incrVal;
+	}
+	memcpy(&word, bytes, sizeof(u32));
+
+	return word;
+}
+
+void Pattern_FillRef(u8* dst, u32 byteCount, u8 startVal, u8 incrVal)
+{
+	for (u32 i = 0; i < byteCount; ++i) {
+		dst[i] = startVal;
+		startVal += incrVal;
+	}
+}
+
+u32 Pattern_CountMismatchesRef(const u8* src, u32 byteCount, u8 startVal, u8 incrVal)
+{
+	u32 errCount = 0;
+
+	for (u32 i = 0; i < byteCount; ++i) {
+		errCount += (src[i] == startVal) ? 0 : 1;
+		startVal += incrVal;
+	}
+
+	return errCount;
+}
+
+void Pattern_Fill(u8* dst, u32 byteCount, u8 startVal, u8 incrVal)
+{
+	u32* dstWords = (u32*) dst;
+	u32 wordCount = byteCount / sizeof(u32);
+	u32 word;
+	u32 wordIncr;
+
+	/* The word kernel requires word alignment, else use the byte kernel. */
+	if ((SF3_PATTERN_WORD_KERNEL == 0) || (((UINTPTR) dst) % sizeof(u32) != 0)) {
+		Pattern_FillRef(dst, byteCount, startVal, incrVal);
+		return;
+	}
+
+	word = Pattern_FirstWord(startVal, incrVal);
+	wordIncr = ((u8)(incrVal * sizeof(u32))) * PATTERN_LANES_ONES;
+
+	for (u32 i = 0; i < wordCount; ++i) {
+		dstWords[i] = word;
+		word = Pattern_LanesAdd(word, wordIncr);
+	}
+
+	Pattern_FillRef(&(dst[wordCount * sizeof(u32)]), byteCount % sizeof(u32),
+			(u8)(startVal + wordCount * sizeof(u32) * incrVal), incrVal);
+}
+
+u32 Pattern_CountMismatches(const u8* src, u32 byteCount, u8 startVal, u8 incrVal)
+{
+	const u32* srcWords = (const u32*) src;
+	u32 wordCount = byteCount / sizeof(u32);
+	u32 word;
+	u32 wordIncr;
+	u32 errCount = 0;
+
+	/* The word kernel requires word alignment, else use the byte kernel. */
+	if ((SF3_PATTERN_WORD_KERNEL == 0) || (((UINTPTR) src) % sizeof(u32) != 0)) {
+		return Pattern_CountMismatchesRef(src, byteCount, startVal, incrVal);
+	}
+
+	word = Pattern_FirstWord(startVal, incrVal);
+	wordIncr = ((u8)(incrVal * sizeof(u32))) * PATTERN_LANES_ONES;
+
+	for (u32 i = 0; i < wordCount; ++i) {
+		errCount += Pattern_LanesNonZeroCount(srcWords[i] ^ word);
+		word = Pattern_LanesAdd(word, wordIncr);
+	}
+
+	errCount += Pattern_CountMismatchesRef(&(src[wordCount * sizeof(u32)]), byteCount % sizeof(u32),
+			(u8)(startVal + wordCount * sizeof(u32) * incrVal), incrVal);
+
+	return errCount;
+}
+
+u32 Pattern_CountImageMismatches(const u8* src, const u8* image, u32 byteCount)
+{
+	const u32* srcWords = (const u32*) src;
+	const u32* imageWords = (const u32*) image;
+	u32 wordCount = byteCount / sizeof(u32);
+	u32 errCount = 0;
+
+	/* A passing buffer is confirmed by the bulk compare alone. */
+	if (memcmp(src, image, byteCount) == 0) {
+		return 0;
+	}
+
+	if ((SF3_PATTERN_WORD_KERNEL == 0) ||
+			((((UINTPTR) src) | ((UINTPTR) image)) % sizeof(u32) != 0)) {
+		wordCount = 0;
+	}
+
+	for (u32 i = 0; i < wordCount; ++i) {
+		errCount += Pattern_LanesNonZeroCount(srcWords[i] ^ imageWords[i]);
+	}
+
+	for (u32 i = wordCount * sizeof(u32); i < byteCount; ++i) {
+		errCount += (src[i] == image[i]) ? 0 : 1;
+	}
+
+	return errCount;
+}
+
+/* Return the offset of the first byte of the buffer that differs from the
+ * image, or the byte count when none differs; for use on the fail path only.
+ */
+u32 Pattern_FindFirstMismatch(const u8* src, const u8* image, u32 byteCount)
+{
+	u32 i;
+
+	for (i = 0; i < byteCount; ++i) {
+		if (src[i] != image[i])
+			break;
+	}
+
+	return i;
+}
+
+/* Helper function to mix the page address into a PRBS-31 seed, so that every
+ * page starts at an unrelated point of the sequence in constant time instead
+ * of replaying the sequence from the start of the iteration.
+ */
+static u32 Pattern_Prbs31Seed(u32 byteAddr)
+{
+	u32 seed = byteAddr ^ PATTERN_PRBS31_SEED_XOR;
+
+	seed ^= seed >> 16;
+	seed *= 0x85EBCA6B;
+	seed ^= seed >> 13;
+	seed *= 0xC2B2AE35;
+	seed ^= seed >> 16;
+
+	seed &= PATTERN_PRBS31_MASK;
+	return (seed == 0) ? 1 : seed;
+}
+
+/* Helper function to fill with the PRBS-31 sequence of x^31 + x^28 + 1,
+ * advancing the LFSR eight steps at a time for each byte.
+ */
+static void Pattern_FillPrbs31(u8* dst, u32 byteCount, u32 byteAddr)
+{
+	u32 state = Pattern_Prbs31Seed(byteAddr);
+	u32 bits;
+
+	for (u32 i = 0; i < byteCount; ++i) {
+		bits = ((state >> 23) ^ (state >> 20)) & 0xFF;
+		state = ((state << 8) | bits) & PATTERN_PRBS31_MASK;
+		dst[i] = (u8) bits;
+	}
+}
+
+/* Helper function to fill each 32-bit word with its own byte address,
+ * least-significant byte first.
+ */
+static void Pattern_FillAddress(u8* dst, u32 byteCount, u32 byteAddr)
+{
+	u32 wordAddr;
+
+	for (u32 i = 0; i < byteCount; ++i) {
+		wordAddr = byteAddr + (i & ~(sizeof(u32) - 1));
+		dst[i] = (u8)(wordAddr >> (8 * (i % sizeof(u32))));
+	}
+}
+
+/* Helper function to fill with a single one bit walking across the byte,
+ * rotated by one position per page so that neighboring pages differ.
+ */
+static void Pattern_FillWalkingOnes(u8* dst, u32 byteCount, u32 byteAddr)
+{
+	u32 pageIndex = byteAddr / PATTERN_PAGE_SIZE;
+
+	for (u32 i = 0; i < byteCount; ++i) {
+		dst[i] = (u8)(0x01 << ((i + pageIndex) % 8));
+	}
+}
+
+/* Helper function to fill with alternating 0x55 and 0xAA bytes, inverted on
+ * every other page.
+ */
+static void Pattern_FillInvCheckerboard(u8* dst, u32 byteCount, u32 byteAddr)
+{
+	u32 pageIndex = byteAddr / PATTERN_PAGE_SIZE;
+
+	for (u32 i = 0; i < byteCount; ++i) {
+		dst[i] = ((i ^ pageIndex) & 0x01) ? 0xAA : 0x55;
+	}
+}
+
+void Pattern_FillPage(u8* dst, u32 byteCount, int pageKind, u32 byteAddr)
+{
+	switch (pageKind) {
+	case PATTERN_PAGE_ADDRESS:
+		Pattern_FillAddress(dst, byteCount, byteAddr);
+		break;
+	case PATTERN_PAGE_PRBS31:
+		Pattern_FillPrbs31(dst, byteCount, byteAddr);
+		break;
+	case PATTERN_PAGE_WALKING_ONES:
+		Pattern_FillWalkingOnes(dst, byteCount, byteAddr);
+		break;
+	case PATTERN_PAGE_INV_CHECKERBOARD:
+		Pattern_FillInvCheckerboard(dst, byteCount, byteAddr);
+		break;
+	default:
+		memset(dst, 0xFF, byteCount);
+		break;
+	}
+}
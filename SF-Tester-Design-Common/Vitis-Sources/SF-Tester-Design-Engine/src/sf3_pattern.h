@@ -0,0 +1,70 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_pattern.h
+ *
+ * @brief
+ * Test pattern kernels that generate and compare the arithmetic byte sequence
+ * of a test pattern four bytes at a time, with byte-exact reference versions,
+ * compare against a precomputed image of the pattern, and generate the
+ * address-dependent page patterns, each seeded directly from the page address.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_SF3_PATTERN_H_
+#define SRC_SF3_PATTERN_H_
+
+#include "xil_types.h"
+
+/* Set to 0 to build the byte-exact reference kernels in place of the word kernels. */
+#ifndef SF3_PATTERN_WORD_KERNEL
+#define SF3_PATTERN_WORD_KERNEL 1
+#endif
+
+/* Page patterns whose contents depend on the flash address of the page. */
+enum PATTERN_PAGE_TAG {
+	PATTERN_PAGE_ADDRESS,
+	PATTERN_PAGE_PRBS31,
+	PATTERN_PAGE_WALKING_ONES,
+	PATTERN_PAGE_INV_CHECKERBOARD,
+	PATTERN_PAGE_NONE
+};
+
+void Pattern_Fill(u8* dst, u32 byteCount, u8 startVal, u8 incrVal);
+u32 Pattern_CountMismatches(const u8* src, u32 byteCount, u8 startVal, u8 incrVal);
+void Pattern_FillRef(u8* dst, u32 byteCount, u8 startVal, u8 incrVal);
+u32 Pattern_CountMismatchesRef(const u8* src, u32 byteCount, u8 startVal, u8 incrVal);
+u32 Pattern_CountImageMismatches(const u8* src, const u8* image, u32 byteCount);
+u32 Pattern_FindFirstMismatch(const u8* src, const u8* image, u32 byteCount);
+void Pattern_FillPage(u8* dst, u32 byteCount, int pageKind, u32 byteAddr);
+
+#endif /* SRC_SF3_PATTERN_H_ */
@@ -0,0 +1,182 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_timing.c
+ *
+ * @brief
+ * Lightweight timestamps and latency statistics for timing the SF3 erase,
+ * program and read commands and the throughput of each test phase.
+ *
+ * The MicroBlaze designs timestamp with the second counter of the AXI Timer,
+ * the first counter being the FreeRTOS tick; the Zynq design timestamps with
+ * the Cortex-A9 global timer.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "xparameters.h"
+#include "sf3_timing.h"
+
+#if defined(__MICROBLAZE__)
+#include "xtmrctr_l.h"
+
+#define TIMING_TMRCTR_BASEADDR XPAR_TMRCTR_0_BASEADDR
+#define TIMING_TMRCTR_NUMBER 1
+#define TIMING_TICKS_PER_SECOND XPAR_TMRCTR_0_CLOCK_FREQ_HZ
+#define TIMING_CPU_CYCLES_PER_SECOND XPAR_CPU_CORE_CLOCK_FREQ_HZ
+#else
+#include "xtime_l.h"
+
+#define TIMING_TICKS_PER_SECOND COUNTS_PER_SECOND
+/* The global timer counts at half of the CPU clock. */
+#define TIMING_CPU_CYCLES_PER_SECOND (2ULL * COUNTS_PER_SECOND)
+#endif
+
+/* Start the free-running timestamp counter. */
+void Timing_Init(void)
+{
+#if defined(__MICROBLAZE__)
+	XTmrCtr_SetControlStatusReg(TIMING_TMRCTR_BASEADDR, TIMING_TMRCTR_NUMBER, 0);
+	XTmrCtr_SetLoadReg(TIMING_TMRCTR_BASEADDR, TIMING_TMRCTR_NUMBER, 0);
+	XTmrCtr_LoadTimerCounterReg(TIMING_TMRCTR_BASEADDR, TIMING_TMRCTR_NUMBER);
+	XTmrCtr_SetControlStatusReg(TIMING_TMRCTR_BASEADDR, TIMING_TMRCTR_NUMBER,
+			XTC_CSR_AUTO_RELOAD_MASK);
+	XTmrCtr_Enable(TIMING_TMRCTR_BASEADDR, TIMING_TMRCTR_NUMBER);
+#else
+	/* The global timer is started by the boot code. */
+#endif
+}
+
+/* Read the timestamp counter; differences of two reads are valid across wrap. */
+u32 Timing_Now(void)
+{
+#if defined(__MICROBLAZE__)
+	return XTmrCtr_GetTimerCounterReg(TIMING_TMRCTR_BASEADDR, TIMING_TMRCTR_NUMBER);
+#else
+	XTime now;
+
+	XTime_GetTime(&now);
+	return (u32) now;
+#endif
+}
+
+u32 Timing_TicksToUs(u64 ticks)
+{
+	return (u32)((ticks * 1000000ULL) / TIMING_TICKS_PER_SECOND);
+}
+
+u32 Timing_TicksToCpuCycles(u64 ticks)
+{
+	return (u32)((ticks * TIMING_CPU_CYCLES_PER_SECOND) / TIMING_TICKS_PER_SECOND);
+}
+
+void Timing_ResetStats(t_timing_stats* stats)
+{
+	memset(stats, 0x00, sizeof(t_timing_stats));
+	stats->minTicks = 0xFFFFFFFFFFFFFFFFULL;
+}
+
+void Timing_RecordLatency(t_timing_stats* stats, u64 ticks)
+{
+	u32 us = Timing_TicksToUs(ticks);
+	u32 bin = 0;
+
+	stats->count++;
+	stats->sumTicks += ticks;
+
+	if (ticks < stats->minTicks)
+		stats->minTicks = ticks;
+
+	if (ticks > stats->maxTicks)
+		stats->maxTicks = ticks;
+
+	while ((us > 1) && (bin < TIMING_HISTOGRAM_BIN_COUNT - 1)) {
+		us >>= 1;
+		bin++;
+	}
+
+	stats->histogram[bin]++;
+}
+
+u32 Timing_AverageUs(const t_timing_stats* stats)
+{
+	return (stats->count) ? Timing_TicksToUs(stats->sumTicks / stats->count) : 0;
+}
+
+/* Start timing a phase, clearing its elapsed time, byte count and latencies. */
+void Timing_PhaseStart(t_timing_phase* phase)
+{
+	phase->lastStamp = Timing_Now();
+	phase->elapsedTicks = 0;
+	phase->byteCount = 0;
+	Timing_ResetStats(&(phase->cmdStats));
+}
+
+/* Accumulate the phase time since the previous update. Updating at least at
+ * every FSM step keeps each difference well within the 32-bit counter wrap. */
+void Timing_PhaseUpdate(t_timing_phase* phase)
+{
+	u32 now = Timing_Now();
+
+	phase->elapsedTicks += (u32)(now - phase->lastStamp);
+	phase->lastStamp = now;
+}
+
+/* Phase throughput in kilobytes (1000 bytes) per second, that is MB/s x 1000. */
+u32 Timing_PhaseKBytesPerSec(const t_timing_phase* phase)
+{
+	u64 us = (phase->elapsedTicks * 1000000ULL) / TIMING_TICKS_PER_SECOND;
+
+	return (us) ? (u32)((phase->byteCount * 1000ULL) / us) : 0;
+}
+
+/* Add the elapsed time, byte count and command latencies of one phase into a
+ * running total of the same phase across iterations. */
+void Timing_PhaseMerge(t_timing_phase* total, const t_timing_phase* phase)
+{
+	const t_timing_stats* stats = &(phase->cmdStats);
+
+	total->elapsedTicks += phase->elapsedTicks;
+	total->byteCount += phase->byteCount;
+	total->cmdStats.count += stats->count;
+	total->cmdStats.sumTicks += stats->sumTicks;
+
+	if (stats->minTicks < total->cmdStats.minTicks)
+		total->cmdStats.minTicks = stats->minTicks;
+
+	if (stats->maxTicks > total->cmdStats.maxTicks)
+		total->cmdStats.maxTicks = stats->maxTicks;
+
+	for (int iBin = 0; iBin < TIMING_HISTOGRAM_BIN_COUNT; ++iBin) {
+		total->cmdStats.histogram[iBin] += stats->histogram[iBin];
+	}
+}
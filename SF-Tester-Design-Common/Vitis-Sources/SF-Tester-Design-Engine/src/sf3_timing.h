@@ -0,0 +1,79 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_timing.h
+ *
+ * @brief
+ * Lightweight timestamps and latency statistics for timing the SF3 erase,
+ * program and read commands and the throughput of each test phase.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_SF3_TIMING_H_
+#define SRC_SF3_TIMING_H_
+
+#include "xil_types.h"
+
+/* Latency histogram bins of power-of-two microseconds: bin 0 counts below
+ * 2 us, bin N counts from 2^N us, and the last bin counts everything longer. */
+#define TIMING_HISTOGRAM_BIN_COUNT 24
+
+/* Latency statistics of one command type, in timestamp ticks. */
+typedef struct TIMING_STATS_TAG {
+	u32 count;
+	u64 minTicks;
+	u64 maxTicks;
+	u64 sumTicks;
+	u32 histogram[TIMING_HISTOGRAM_BIN_COUNT];
+} t_timing_stats;
+
+/* Elapsed time and byte count of one test phase, with its command latencies. */
+typedef struct TIMING_PHASE_TAG {
+	u32 lastStamp;
+	u64 elapsedTicks;
+	u64 byteCount;
+	t_timing_stats cmdStats;
+} t_timing_phase;
+
+void Timing_Init(void);
+u32 Timing_Now(void);
+u32 Timing_TicksToUs(u64 ticks);
+u32 Timing_TicksToCpuCycles(u64 ticks);
+void Timing_ResetStats(t_timing_stats* stats);
+void Timing_RecordLatency(t_timing_stats* stats, u64 ticks);
+u32 Timing_AverageUs(const t_timing_stats* stats);
+void Timing_PhaseStart(t_timing_phase* phase);
+void Timing_PhaseUpdate(t_timing_phase* phase);
+u32 Timing_PhaseKBytesPerSec(const t_timing_phase* phase);
+void Timing_PhaseMerge(t_timing_phase* total, const t_timing_phase* phase);
+
+#endif /* SRC_SF3_TIMING_H_ */
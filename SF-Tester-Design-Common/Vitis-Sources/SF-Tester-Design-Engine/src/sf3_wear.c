@@ -0,0 +1,186 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_wear.c
+ *
+ * @brief
+ * Wear and coverage record of the regions of an SF3 device over the runs of
+ * one power-up: erase counters of each subsector, and the test count and
+ * failing streak of each region, from which the next region to test is picked.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "sf3_wear.h"
+
+#define WEAR_COUNT_MAX 0xFFFF
+#define WEAR_STREAK_MAX 0xFF
+
+/* Attach the subsector storage to the record and clear it; regions beyond
+ * WEAR_REGION_COUNT_MAX are not tracked. */
+void Wear_Init(t_wear* wear, u16* subsectorEraseCounts, u32 subsectorCount,
+		u32 regionByteCount, u32 regionCount)
+{
+	wear->subsectorEraseCounts = subsectorEraseCounts;
+	wear->subsectorCount = subsectorCount;
+	wear->regionByteCount = regionByteCount;
+	wear->regionCount = (regionCount < WEAR_REGION_COUNT_MAX) ? regionCount : WEAR_REGION_COUNT_MAX;
+	wear->coveredCount = 0;
+	wear->lastRegion = wear->regionCount - 1; /* the first region picked is region 0 */
+
+	memset(wear->subsectorEraseCounts, 0x00, wear->subsectorCount * sizeof(u16));
+	memset(wear->regions, 0x00, sizeof(wear->regions));
+}
+
+/* Helper function to count one erase of each subsector of the erased range,
+ * raising the wear of the regions that hold them if regionWear is set. */
+static void Wear_CountErase(t_wear* wear, u32 addr, u32 byteCount, bool regionWear)
+{
+	const u32 iFirst = addr >> WEAR_SUBSECTOR_SHIFT;
+	const u32 iEnd = (addr + byteCount) >> WEAR_SUBSECTOR_SHIFT;
+	u32 iRegion;
+	u16 count;
+
+	for (u32 iSub = iFirst; (iSub < iEnd) && (iSub < wear->subsectorCount); ++iSub) {
+		count = wear->subsectorEraseCounts[iSub];
+		if (count < WEAR_COUNT_MAX)
+			wear->subsectorEraseCounts[iSub] = ++count;
+
+		iRegion = (iSub << WEAR_SUBSECTOR_SHIFT) / wear->regionByteCount;
+		if ((regionWear) && (iRegion < wear->regionCount) && (wear->regions[iRegion].eraseCount < count))
+			wear->regions[iRegion].eraseCount = count;
+	}
+}
+
+/* Count one erase of each subsector of the erased range. */
+void Wear_RecordErase(t_wear* wear, u32 addr, u32 byteCount)
+{
+	Wear_CountErase(wear, addr, byteCount, true);
+}
+
+/* Count one erase of each subsector of an erased range that is never tested,
+ * such as the run header, without raising the wear of the region that holds
+ * it, from which the region is scheduled. */
+void Wear_RecordReservedErase(t_wear* wear, u32 addr, u32 byteCount)
+{
+	Wear_CountErase(wear, addr, byteCount, false);
+}
+
+/* Record the result of a run of the range on each region the range overlaps;
+ * a failing region is marked to be retested, up to WEAR_RETEST_MAX runs in a
+ * row, so that a region failing on every run is not tested to the exclusion
+ * of the others. */
+void Wear_RecordRun(t_wear* wear, u32 addr, u32 byteCount, bool failed)
+{
+	t_wear_region* region;
+
+	if (byteCount == 0)
+		return;
+
+	for (u32 iRegion = addr / wear->regionByteCount;
+			(iRegion <= (addr + byteCount - 1) / wear->regionByteCount) &&
+			(iRegion < wear->regionCount); ++iRegion) {
+		region = &(wear->regions[iRegion]);
+
+		if (region->testCount == 0)
+			wear->coveredCount++;
+		if (region->testCount < WEAR_COUNT_MAX)
+			region->testCount++;
+
+		if (failed) {
+			if (region->failStreak < WEAR_STREAK_MAX)
+				region->failStreak++;
+			region->retestPending = (region->failStreak <= WEAR_RETEST_MAX);
+		} else {
+			region->failStreak = 0;
+			region->retestPending = false;
+		}
+	}
+}
+
+/* Pick the region to test next: a region marked to be retested, else the
+ * least erased region, and of those the least tested. The search starts after
+ * the region picked last, so that equally worn regions are taken in turn and,
+ * retests aside, every region is covered before any region is erased twice.
+ */
+u32 Wear_NextRegion(t_wear* wear)
+{
+	u32 best = wear->regionCount;
+	u32 iRegion;
+	const t_wear_region* region;
+
+	for (u32 i = 1; i <= wear->regionCount; ++i) {
+		iRegion = (wear->lastRegion + i) % wear->regionCount;
+		if (wear->regions[iRegion].retestPending) {
+			best = iRegion;
+			break;
+		}
+	}
+
+	if (best == wear->regionCount) {
+		for (u32 i = 1; i <= wear->regionCount; ++i) {
+			iRegion = (wear->lastRegion + i) % wear->regionCount;
+			region = &(wear->regions[iRegion]);
+
+			if ((best == wear->regionCount) ||
+					(region->eraseCount < wear->regions[best].eraseCount) ||
+					((region->eraseCount == wear->regions[best].eraseCount) &&
+							(region->testCount < wear->regions[best].testCount))) {
+				best = iRegion;
+			}
+		}
+	}
+
+	wear->regions[best].retestPending = false;
+	wear->lastRegion = best;
+
+	return best;
+}
+
+/* Return the erase count of the least erased region. */
+u16 Wear_LeastErased(const t_wear* wear)
+{
+	u16 least = wear->regions[0].eraseCount;
+
+	for (u32 iRegion = 1; iRegion < wear->regionCount; ++iRegion) {
+		if (wear->regions[iRegion].eraseCount < least)
+			least = wear->regions[iRegion].eraseCount;
+	}
+
+	return least;
+}
+
+/* Indicate that every region has been tested at least once. */
+bool Wear_IsCovered(const t_wear* wear)
+{
+	return (wear->coveredCount == wear->regionCount);
+}
@@ -0,0 +1,87 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_wear.h
+ *
+ * @brief
+ * Wear and coverage record of the regions of an SF3 device over the runs of
+ * one power-up: erase counters of each subsector, and the test count and
+ * failing streak of each region, from which the next region to test is picked.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_SF3_WEAR_H_
+#define SRC_SF3_WEAR_H_
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+/* Most regions a record divides the device into. */
+#define WEAR_REGION_COUNT_MAX 64
+
+/* Subsector size of the N25Q, the granularity of the erase counters. */
+#define WEAR_SUBSECTOR_SHIFT 12
+
+/* Consecutive failing runs of a region that are each followed by a retest
+ * of the region ahead of the others. */
+#define WEAR_RETEST_MAX 2
+
+/* Wear and results of one region of the device. */
+typedef struct WEAR_REGION_TAG {
+	u16 eraseCount; /* most erases of any of its subsectors, saturating */
+	u16 testCount;  /* runs that tested the region, saturating */
+	u8 failStreak;  /* consecutive runs that failed */
+	bool retestPending;
+} t_wear_region;
+
+/* Wear record of one device, with the subsector counters stored in an array
+ * provided by the caller, one element per subsector of the device. */
+typedef struct WEAR_TAG {
+	u16* subsectorEraseCounts; /* saturating */
+	u32 subsectorCount;
+	u32 regionByteCount;
+	u32 regionCount;
+	u32 coveredCount; /* regions tested at least once */
+	u32 lastRegion;   /* region picked last */
+	t_wear_region regions[WEAR_REGION_COUNT_MAX];
+} t_wear;
+
+void Wear_Init(t_wear* wear, u16* subsectorEraseCounts, u32 subsectorCount,
+		u32 regionByteCount, u32 regionCount);
+void Wear_RecordErase(t_wear* wear, u32 addr, u32 byteCount);
+void Wear_RecordReservedErase(t_wear* wear, u32 addr, u32 byteCount);
+void Wear_RecordRun(t_wear* wear, u32 addr, u32 byteCount, bool failed);
+u32 Wear_NextRegion(t_wear* wear);
+u16 Wear_LeastErased(const t_wear* wear);
+bool Wear_IsCovered(const t_wear* wear);
+
+#endif /* SRC_SF3_WEAR_H_ */
@@ -0,0 +1,195 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_board.c
+ *
+ * @brief
+ * Board support of the SF3 test engine for the Arty A7-100.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "xparameters.h"
+#include "xintc.h"
+#include "xuartlite.h"
+#include "Experiment.h"
+#include "sf3_board.h"
+#include "sf3_console.h"
+
+/* SF3 device instances of the design, each tested by its own pair of tasks */
+typedef struct BOARD_SF3_CONFIG_DESC_TAG {
+	u32 spiBaseAddr;
+	u32 intcVecId;
+	u32 qspiIntr;
+} t_board_sf3_config;
+
+static const t_board_sf3_config c_board_sf3_configs[SF3_DEVICE_COUNT] = {
+	{XPAR_PMODSF3_0_AXI_LITE_SPI_BASEADDR, XPAR_INTC_0_PMODSF3_0_VEC_ID,
+			XPAR_MICROBLAZE_0_AXI_INTC_PMODSF3_0_QSPI_INTERRUPT_INTR},
+#if SF3_DEVICE_COUNT > 1
+	{XPAR_PMODSF3_1_AXI_LITE_SPI_BASEADDR, XPAR_INTC_0_PMODSF3_1_VEC_ID,
+			XPAR_MICROBLAZE_0_AXI_INTC_PMODSF3_1_QSPI_INTERRUPT_INTR},
+#endif
+#if SF3_DEVICE_COUNT > 2
+	{XPAR_PMODSF3_2_AXI_LITE_SPI_BASEADDR, XPAR_INTC_0_PMODSF3_2_VEC_ID,
+			XPAR_MICROBLAZE_0_AXI_INTC_PMODSF3_2_QSPI_INTERRUPT_INTR},
+#endif
+#if SF3_DEVICE_COUNT > 3
+	{XPAR_PMODSF3_3_AXI_LITE_SPI_BASEADDR, XPAR_INTC_0_PMODSF3_3_VEC_ID,
+			XPAR_MICROBLAZE_0_AXI_INTC_PMODSF3_3_QSPI_INTERRUPT_INTR},
+#endif
+};
+
+#if defined(XPAR_INTC_0_UARTLITE_0_VEC_ID)
+/* UARTlite of the console, also the standard output of the BSP */
+static XUartLite boardConsoleUart;
+#endif
+
+const u8 c_board_rgb_led_silks[BOARD_RGB_LED_COUNT] = {0, 1, 2, 3};
+
+const u8 c_board_status_led_silks[BOARD_STATUS_LED_COUNT] = {4, 5, 6, 7};
+
+/* The RGB LED lit by each of test patterns A through H. */
+const t_board_rgb_led_lit c_board_pattern_leds[BOARD_PATTERN_LED_COUNT] = {
+	{0, {0, 0xFF, 0}},
+	{1, {0, 0xFF, 0}},
+	{2, {0, 0xFF, 0}},
+	{3, {0, 0xFF, 0}},
+	{0, {0, 0, 0xFF}},
+	{1, {0, 0, 0xFF}},
+	{2, {0, 0, 0xFF}},
+	{3, {0, 0, 0xFF}}
+};
+
+/* The RGB LED lit by each step of the test, from the erase to the final
+ * display. */
+const t_board_rgb_led_lit c_board_step_leds[BOARD_LED_STEP_NONE] = {
+	{0, {0x80, 0x80, 0x80}},
+	{0, {0x70, 0x10, 0}},
+	{1, {0x80, 0x80, 0x80}},
+	{1, {0x70, 0x10, 0}},
+	{2, {0x80, 0x80, 0x80}},
+	{2, {0x70, 0x10, 0}},
+	{3, {0x80, 0x80, 0x80}}
+};
+
+/* Initialize the PMOD SF3 driver targeted at FreeRTOS (instead of the regular
+ * PMOD SF3 driver targeted at standalone), with the interrupt of the device
+ * connected to the AXI interrupt controller.
+ */
+XStatus Board_Sf3Begin(PmodSF3* InstancePtr, int deviceIndex)
+{
+	const t_board_sf3_config* devConfig = &(c_board_sf3_configs[deviceIndex]);
+	XStatus Status;
+
+	Status = SF3_begin_freertos(InstancePtr,
+			devConfig->spiBaseAddr,
+			devConfig->intcVecId,
+			devConfig->qspiIntr);
+
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Enter the QSPI interrupt through the engine, which stamps its latency
+	 * before calling the driver handler. */
+	if (xPortInstallInterruptHandler(devConfig->intcVecId, Experiment_Sf3IntrHandler,
+			(void*)(UINTPTR) deviceIndex) != pdPASS) {
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/* Install the interrupt of the switch and button GPIO, on an edge of either
+ * channel, in the AXI interrupt controller; the handler clears it. */
+XStatus Board_UserInputsBegin(XGpio* InstancePtr, XInterruptHandler handler,
+		void* callbackRef)
+{
+#if defined(XPAR_INTC_0_GPIO_0_VEC_ID)
+	if (xPortInstallInterruptHandler(XPAR_INTC_0_GPIO_0_VEC_ID, handler,
+			callbackRef) != pdPASS) {
+		return XST_FAILURE;
+	}
+
+	XGpio_InterruptClear(InstancePtr, XGPIO_IR_CH1_MASK | XGPIO_IR_CH2_MASK);
+	XGpio_InterruptEnable(InstancePtr, XGPIO_IR_CH1_MASK | XGPIO_IR_CH2_MASK);
+	XGpio_InterruptGlobalEnable(InstancePtr);
+	vPortEnableInterrupt(XPAR_INTC_0_GPIO_0_VEC_ID);
+
+	return XST_SUCCESS;
+#else
+	return XST_NO_FEATURE;
+#endif
+}
+
+#if defined(XPAR_INTC_0_UARTLITE_0_VEC_ID)
+/* Called by the UARTlite interrupt handler once a send has left the FIFO. */
+static void Board_ConsoleSentHandler(void* callbackRef, unsigned int byteCount)
+{
+	Console_SendDone();
+}
+#endif
+
+/* Initialize the UARTlite of the console to send from its interrupt, which
+ * refills the 16 byte FIFO as it empties. */
+XStatus Board_ConsoleBegin(void)
+{
+#if defined(XPAR_INTC_0_UARTLITE_0_VEC_ID)
+	if (XUartLite_Initialize(&boardConsoleUart, XPAR_UARTLITE_0_DEVICE_ID) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XUartLite_SetSendHandler(&boardConsoleUart, Board_ConsoleSentHandler, NULL);
+
+	if (xPortInstallInterruptHandler(XPAR_INTC_0_UARTLITE_0_VEC_ID,
+			(XInterruptHandler) XUartLite_InterruptHandler, &boardConsoleUart) != pdPASS) {
+		return XST_FAILURE;
+	}
+
+	XUartLite_EnableInterrupt(&boardConsoleUart);
+	vPortEnableInterrupt(XPAR_INTC_0_UARTLITE_0_VEC_ID);
+
+	return XST_SUCCESS;
+#else
+	return XST_NO_FEATURE;
+#endif
+}
+
+/* Start the send of the bytes, which stay in place until the send is done. */
+void Board_ConsoleSend(const u8* buffer, u32 byteCount)
+{
+#if defined(XPAR_INTC_0_UARTLITE_0_VEC_ID)
+	XUartLite_Send(&boardConsoleUart, (u8*) buffer, byteCount);
+#endif
+}
@@ -40,7 +40,11 @@ module fpga_serial_mem_tester_s725
   import pmod_quad_spi_solo_pkg::*;
   import sf_tester_fsm_pkg::*;
     #(parameter
-        integer parm_fast_simulation = 0)
+        integer parm_fast_simulation = 0,
+        integer parm_no_hold = 0,
+        integer parm_sf3_fast_sck = 0,
+        integer parm_sf3_rx_capture_delay = 3,
+        integer parm_uart_baud = 921600)
     (
     // External clock and active-low reset
     input logic CLK12MHZ,
@@ -181,8 +185,20 @@ logic [3:0] s_sw_deb;
 logic [3:0] si_buttons;
 logic [3:0] s_btns_deb;
 
+// SF3 SPI bus clock, at 5 MHz, or at 10 MHz if the fast SCK is selected,
+// which holds the clock enable at the 40 MHz clock.
+// The 10 MHz selection is experimental: it has not been simulated or
+// verified on the board, and needs the genclk10mhz line of the timing XDC.
+localparam integer c_sf3_sck_freq = (parm_sf3_fast_sck == 0) ? 5000000 : 10000000;
+
 // SF3 clock enable division down from 40 MHz
-localparam integer c_sf3_tester_ce_div_ratio = (c_FCLK / 5000000 / 4);
+localparam integer c_sf3_tester_ce_div_ratio = (c_FCLK / c_sf3_sck_freq / 4);
+
+// SF3 read-capture delay in 4x clock enables of the SPI FSM state, from 3
+// to 7. The default of 3 is the capture point of the 5 MHz clock; no value
+// has been validated on the board with the 10 MHz clock of
+// parm_sf3_fast_sck, so select the delay for it from a board test.
+localparam integer c_sf3_rx_capture_delay = parm_sf3_rx_capture_delay;
 
 // SF3 Tester FSM state outputs
 t_tester_state s_sf3_tester_pr_state;
@@ -200,8 +216,15 @@ logic [(2*8-1):0] s_color_led_green_value;
 logic [(2*8-1):0] s_color_led_blue_value;
 logic [(4*8-1):0] s_basic_led_lumin_value;
 
-// UART TX signals to connect \ref uart_tx_only and \ref uart_tx_feed
-logic [(35*8-1):0] s_uart_txt_ascii_line;
+// UART TX signals to connect \ref uart_tx_only and \ref uart_tx_feed ,
+// with the almost full offset of the UART TX FIFO one more than the bytes of
+// the lines that the feed enqueues per TX Ready
+localparam integer c_uart_ascii_line_length = 35;
+localparam integer c_uart_line_count = 1;
+localparam logic [10:0] c_uart_almost_full_thresh =
+  11'(c_uart_line_count * c_uart_ascii_line_length + 1);
+
+logic [(c_uart_line_count*c_uart_ascii_line_length*8-1):0] s_uart_txt_ascii_line;
 logic s_uart_tx_go;
 logic [7:0] s_uart_txdata;
 logic s_uart_txvalid;
@@ -402,7 +425,8 @@ pmod_cls_custom_driver #(
 pmod_sf3_custom_driver #(
   .parm_fast_simulation(parm_fast_simulation),
   .parm_FCLK(c_FCLK),
-  .parm_ext_spi_clk_ratio(c_sf3_tester_ce_div_ratio * 4)
+  .parm_ext_spi_clk_ratio(c_sf3_tester_ce_div_ratio * 4),
+  .parm_rx_capture_delay(c_sf3_rx_capture_delay)
   // Note: old parameter mapping of *_count_bits was moved to be declared
   // as a SystemVerilog interface defined within package
   // pmod_quad_spi_solo_pkg.
@@ -460,6 +484,7 @@ assign sio_sf3_hldn_dq3_i = eio_pmod_sf3_hldn_dq3;
 // SF3 Tester FSM
 sf_tester_fsm #(
   .parm_fast_simulation(parm_fast_simulation),
+  .parm_no_hold(parm_no_hold),
   .parm_FCLK(c_FCLK),
   .parm_sf3_tester_ce_div_ratio(c_sf3_tester_ce_div_ratio),
   .parm_pattern_startval_a(c_tester_pattern_startval_a),
@@ -558,7 +583,9 @@ lcd_text_feed #(
 assign s_uart_tx_go = s_cls_wr_clear_display;
 
 uart_tx_only #(
-  .parm_BAUD(115200)
+  .parm_BAUD(parm_uart_baud),
+  .parm_ascii_line_length(c_uart_ascii_line_length),
+  .parm_almost_full_thresh(c_uart_almost_full_thresh)
   ) u_uart_tx_only (
   .i_clk_40mhz  (s_clk_40mhz),
   .i_rst_40mhz  (s_rst_40mhz),
@@ -571,6 +598,8 @@ uart_tx_only #(
   );
 
 uart_tx_feed #(
+  .parm_ascii_line_length(c_uart_ascii_line_length),
+  .parm_line_count(c_uart_line_count)
   ) u_uart_tx_feed (
   .i_clk_40mhz(s_clk_40mhz),
   .i_rst_40mhz(s_rst_40mhz),
@@ -39,7 +39,12 @@ module pmod_generic_qspi_solo
     import pmod_quad_spi_solo_pkg::*;
     #(parameter
         // Ratio of i_ext_spi_clk_x to SPI sck bus output.
-        integer parm_ext_spi_clk_ratio = 32
+        integer parm_ext_spi_clk_ratio = 32,
+        // Count of 4x clock enables that the RX capture lags the SPI FSM
+        // state, covering the registration of outputs, the round trip through
+        // the pads and the peripheral, and the double registration of inputs.
+        // Valid values are 3 through 7.
+        integer parm_rx_capture_delay = 3
         )
     (
         // SPI bus outputs and input to top-level
@@ -90,9 +95,7 @@ typedef enum logic [(`c_spi_state_bits - 1):0] {
 (* fsm_safe_state = "default_state" *)
 t_spi_state s_spi_pr_state = ST_ENHAN_IDLE;
 t_spi_state s_spi_nx_state = ST_ENHAN_IDLE;
-t_spi_state s_spi_pr_state_delayed1 = ST_ENHAN_IDLE;
-t_spi_state s_spi_pr_state_delayed2 = ST_ENHAN_IDLE;
-t_spi_state s_spi_pr_state_delayed3 = ST_ENHAN_IDLE;
+t_spi_state s_spi_pr_state_delayed [1:parm_rx_capture_delay] = '{default: ST_ENHAN_IDLE};
 
 // Data start FSM state declarations
 `define c_dat_state_bits 3
@@ -122,9 +125,7 @@ localparam t_timer_enhan_value c_tmax = c_t_enhan_max_tx;
 t_timer_enhan_value s_t_inc; // Value of 1 or 4
 
 t_timer_enhan_value s_t;
-t_timer_enhan_value s_t_delayed1;
-t_timer_enhan_value s_t_delayed2;
-t_timer_enhan_value s_t_delayed3;
+t_timer_enhan_value s_t_delayed [1:parm_rx_capture_delay];
 
 // SPI 4x and 1x clocking signals and enables
 logic s_spi_ce_4x;
@@ -133,6 +134,7 @@ logic s_spi_clk_ce0;
 logic s_spi_clk_ce1;
 logic s_spi_clk_ce2;
 logic s_spi_clk_ce3;
+logic s_spi_clk_ce_rx;
 
 // FSM pulse stretched
 logic s_go_enhan;
@@ -340,20 +342,24 @@ assign s_spi_clk_ce1 = (v_phase_counter == parm_ext_spi_clk_ratio / 4 * 1) && s_
 assign s_spi_clk_ce2 = (v_phase_counter == parm_ext_spi_clk_ratio / 4 * 2) && s_spi_ce_4x;
 assign s_spi_clk_ce3 = (v_phase_counter == parm_ext_spi_clk_ratio / 4 * 3) && s_spi_ce_4x;
 
+// Read-capture clock enable, at the 25% point that the delayed FSM state
+// reaches its second 4x clock enable, as CE 3 does for the default delay of 3.
+assign s_spi_clk_ce_rx = (v_phase_counter ==
+    parm_ext_spi_clk_ratio / 4 * (parm_rx_capture_delay % 4)) && s_spi_ce_4x;
+
 // Timer 1 (Strategy #1) with comstant timer increment
 always_ff @(posedge i_ext_spi_clk_x)
 begin: p_timer_1
     if (i_srst) begin
         s_t <= 0;
-        s_t_delayed1 <= 0;
-        s_t_delayed2 <= 0;
-        s_t_delayed3 <= 0;
+        for (int i = 1; i <= parm_rx_capture_delay; i++)
+            s_t_delayed[i] <= 0;
         s_t_inc      <= 1;
     end else begin
         if (i_spi_ce_4x) begin
-            s_t_delayed3 <= s_t_delayed2;
-            s_t_delayed2 <= s_t_delayed1;
-            s_t_delayed1 <= s_t;
+            for (int i = parm_rx_capture_delay; i > 1; i--)
+                s_t_delayed[i] <= s_t_delayed[i - 1];
+            s_t_delayed[1] <= s_t;
         end
 
         if (s_spi_clk_ce2) // clock enable on falling SPI edge for timer change
@@ -445,18 +451,17 @@ end : p_dat_fsm_comb
 always_ff @(posedge i_ext_spi_clk_x)
 begin: p_spi_fsm_state
     if (i_srst) begin
-        s_spi_pr_state_delayed3 <= ST_ENHAN_IDLE;
-        s_spi_pr_state_delayed2 <= ST_ENHAN_IDLE;
-        s_spi_pr_state_delayed1 <= ST_ENHAN_IDLE;
+        for (int i = 1; i <= parm_rx_capture_delay; i++)
+            s_spi_pr_state_delayed[i] <= ST_ENHAN_IDLE;
         s_spi_pr_state          <= ST_ENHAN_IDLE;
     end else begin  : if_fsm_state_and_delayed
         // The delayed state value allows for registration of TX clock
         // and double registration of RX value to capture after the
         // registration of outputs and synchronization of inputs.
         if (s_spi_ce_4x) begin
-            s_spi_pr_state_delayed3 <= s_spi_pr_state_delayed2;
-            s_spi_pr_state_delayed2 <= s_spi_pr_state_delayed1;
-            s_spi_pr_state_delayed1 <= s_spi_pr_state;
+            for (int i = parm_rx_capture_delay; i > 1; i--)
+                s_spi_pr_state_delayed[i] <= s_spi_pr_state_delayed[i - 1];
+            s_spi_pr_state_delayed[1] <= s_spi_pr_state;
         end
 
         if (s_spi_clk_ce2) // clock enable on falling SPI edge for state change
@@ -701,28 +706,31 @@ begin: p_spi_fsm_comb
 end : p_spi_fsm_comb
 
 // Captures the RX inputs into the RX fifo.
-// Note that the RX inputs are delayed by 3 clk_4x clock cycles.
+// Note that the RX inputs are delayed by 3 clk_4x clock cycles by default.
 // Before the delay, the falling edge would occur at the capture of
 // clock enable 0; but with the delay of registering output and double
 // registering input, the FSM state is delayed by 3 clock cycles for
 // RX only and the clock enable to process on the effective falling edge of
 // the bus SCK as perceived from propagation out and back in, is 3 clock
-// cycles, thus CE 3 instead of CE 0.
+// cycles, thus CE 3 instead of CE 0. At a faster SCK, the propagation out
+// and back in is a larger part of the SCK period, and the capture can be
+// delayed further by \ref parm_rx_capture_delay , with the capture clock
+// enable following it.
 always_ff @(posedge i_ext_spi_clk_x)
 begin: p_spi_fsm_inputs
     if (i_srst) begin
         s_data_fifo_rx_we <= 1'b0;
         s_data_fifo_rx_in <= 8'h00;
     end else
-        if (s_spi_clk_ce3)
-            if (s_spi_pr_state_delayed3 == ST_ENHAN_RX) begin : if_shift_in_rx_data_to_fifo
+        if (s_spi_clk_ce_rx)
+            if (s_spi_pr_state_delayed[parm_rx_capture_delay] == ST_ENHAN_RX) begin : if_shift_in_rx_data_to_fifo
                 // input current byte to enqueue, one bit at a time, shifting
-                s_data_fifo_rx_in <= (s_t_delayed3 < (8 * s_rx_len_aux)) ?
+                s_data_fifo_rx_in <= (s_t_delayed[parm_rx_capture_delay] < (8 * s_rx_len_aux)) ?
                     {s_data_fifo_rx_in[6-:7], eio_cipo_dq1_i} : 8'h00;
 
                 // only if on last bit, enqueue another byte
                 // only if RX FIFO is not full, enqueue another byte
-                s_data_fifo_rx_we <= ((s_t_delayed3 % 8 == 7) &&
+                s_data_fifo_rx_we <= ((s_t_delayed[parm_rx_capture_delay] % 8 == 7) &&
                     (s_data_fifo_rx_full == 1'b0)) ? 1'b1 : 1'b0;
             end : if_shift_in_rx_data_to_fifo
             else begin : if_rx_hold_we_low_without_data
@@ -43,7 +43,10 @@ module pmod_sf3_custom_driver
         // Actual frequency in Hz of \ref i_clk_mhz
         integer parm_FCLK = 20000000,
         // Ratio of i_ext_spi_clk_x to SPI sck bus output.
-        integer parm_ext_spi_clk_ratio = 4
+        integer parm_ext_spi_clk_ratio = 4,
+        // Count of 4x clock enables that the RX capture lags the SPI FSM
+        // state in \ref pmod_generic_qspi_solo .
+        integer parm_rx_capture_delay = 3
         )
     (
         // Clock and reset, with clock at 4^N times the frequency of the SPI bus
@@ -111,24 +114,28 @@ logic sio_dq0_fsm_o;
 logic sio_dq0_fsm_t;
 
 logic sio_dq0_sync_i;
+(* IOB = "TRUE" *)
 logic sio_dq0_meta_i;
 
 logic sio_dq1_fsm_o;
 logic sio_dq1_fsm_t;
 
 logic sio_dq1_sync_i;
+(* IOB = "TRUE" *)
 logic sio_dq1_meta_i;
 
 logic sio_dq2_fsm_o;
 logic sio_dq2_fsm_t;
 
 logic sio_dq2_sync_i;
+(* IOB = "TRUE" *)
 logic sio_dq2_meta_i;
 
 logic sio_dq3_fsm_o;
 logic sio_dq3_fsm_t;
 
 logic sio_dq3_sync_i;
+(* IOB = "TRUE" *)
 logic sio_dq3_meta_i;
 
 
@@ -162,7 +169,8 @@ end : p_reg_spi_fsm_out
 
 // Two-stage synchronize the SPI FSM inputs for best practice.
 // Note that the QSPI driver assumes this with its clock-enable phase
-// timings.
+// timings. The first stage is packed into the input register of the pad,
+// so that the read-capture timing does not vary with placement.
 always @(posedge i_clk_mhz)
 begin: p_sync_spi_in
     if (i_ce_mhz_div) begin : ce_register_spi_ins
@@ -212,7 +220,8 @@ pmod_sf3_quad_spi_solo #(
 // Quad bus Extended SPI driver for generic usage, for use with a single
 // peripheral.
 pmod_generic_qspi_solo #(
-    .parm_ext_spi_clk_ratio (parm_ext_spi_clk_ratio)
+    .parm_ext_spi_clk_ratio (parm_ext_spi_clk_ratio),
+    .parm_rx_capture_delay (parm_rx_capture_delay)
     ) u_pmod_generic_qspi_solo (
     .i_ext_spi_clk_x(i_clk_mhz),
     .i_srst(i_rst_mhz),
@@ -36,6 +36,11 @@ module sf_tester_fsm
         // synthesis timing for the purpose of displaying SPI bus with a visual
         // testbench.
         integer parm_fast_simulation = 0,
+        // define as non-zero to skip the timed holds between the erase,
+        // program, and read phases, running the tester at the throughput of
+        // the N25Q flash instead of pausing for display and SPY capture.
+        // Not yet simulated; see the README.
+        integer parm_no_hold = 0,
         // Frequency of the clock
         integer parm_FCLK = 40000000,
         // Ratio of the clock enable to the clock
@@ -91,6 +96,10 @@ timeprecision 1ps;
 // for hardaware execution.
 localparam integer c_t_max = fn_set_t_max(parm_FCLK, parm_sf3_tester_ce_div_ratio, parm_fast_simulation);
 
+// Hold counts of the phase transitions, zero if the holds are disabled.
+localparam integer c_t_hold = (parm_no_hold == 0) ? c_t_max : 0;
+localparam integer c_t_hold_half = (parm_no_hold == 0) ? (c_t_max / 2) : 0;
+
 // Timer variable
 logic [$clog2(c_t_max)-1:0] s_t;
 
@@ -107,8 +116,6 @@ logic s_test_pass_val;
 logic s_test_pass_aux;
 logic s_test_done_val;
 logic s_test_done_aux;
-logic [$clog2(parm_max_possible_byte_count)-1:0] s_err_count_val;
-logic [$clog2(parm_max_possible_byte_count)-1:0] s_err_count_aux;
 logic [7:0] s_pattern_start_val;
 logic [7:0] s_pattern_start_aux;
 logic [7:0] s_pattern_incr_val;
@@ -122,6 +129,13 @@ logic s_start_at_zero_aux;
 logic [$clog2(parm_tester_page_cnt_per_iter)-1:0] s_i_val;
 logic [$clog2(parm_tester_page_cnt_per_iter)-1:0] s_i_aux;
 
+// Comparator pipeline stage registers
+logic s_cmp_valid;
+logic s_cmp_valid_d1;
+logic [7:0] s_cmp_rd_data_d1;
+logic [7:0] s_cmp_expect_d1;
+logic [$clog2(parm_max_possible_byte_count)-1:0] s_err_count_aux;
+
 localparam logic c_force_fake_errors = 1'b0; // only set this to 1'b1 to demo fake errors
 
 //Part 3: Statements------------------------------------------------------------
@@ -157,7 +171,6 @@ begin : p_tester_fsm_state
         s_dat_rd_cntidx_aux   <= 0;
         s_test_pass_aux       <= 1'b0;
         s_test_done_aux       <= 1'b0;
-        s_err_count_aux       <= 0;
         s_pattern_start_aux   <= parm_pattern_startval_a;
         s_pattern_incrval_aux <= parm_pattern_incrval_a;
         s_pattern_track_aux   <= 8'h00;
@@ -172,7 +185,6 @@ begin : p_tester_fsm_state
         s_dat_rd_cntidx_aux   <= s_dat_rd_cntidx_val;
         s_test_pass_aux       <= s_test_pass_val;
         s_test_done_aux       <= s_test_done_val;
-        s_err_count_aux       <= s_err_count_val;
         s_pattern_start_aux   <= s_pattern_start_val;
         s_pattern_incrval_aux <= s_pattern_incr_val;
         s_pattern_track_aux   <= s_pattern_track_val;
@@ -182,6 +194,36 @@ begin : p_tester_fsm_state
     end
 end : p_tester_fsm_state
 
+// Comparator pipeline stage for the serial flash tester FSM. The byte read
+// from the SF3 driver FIFO and the expected pattern byte are registered on
+// the clock enable that the FSM accepts them, and compared on the next clock
+// enable, so that the FIFO output is not in the same path as the error
+// counter adder. The error count settles one clock enable after the last
+// byte of a page, well before the FSM reaches \ref ST_DISPLAY_FINAL.
+always_ff @(posedge i_clk_40mhz)
+begin : p_tester_compare
+    if (i_rst_40mhz) begin
+        s_cmp_valid_d1   <= 1'b0;
+        s_cmp_rd_data_d1 <= 8'h00;
+        s_cmp_expect_d1  <= 8'h00;
+        s_err_count_aux  <= 0;
+
+    end else if (i_ce_div) begin
+        s_cmp_valid_d1   <= s_cmp_valid;
+        s_cmp_rd_data_d1 <= i_sf3_rd_data_stream;
+        s_cmp_expect_d1  <= s_pattern_track_aux;
+
+        if (s_cmp_valid_d1) begin
+            // Compare the byte value registered on the prior clock enable
+            if (s_cmp_rd_data_d1 != s_cmp_expect_d1)
+                s_err_count_aux <= s_err_count_aux + 1;
+            else // If c_force_fake_errors is non-zero, then fake errors are injected.
+                s_err_count_aux <= s_err_count_aux +
+                    ((c_force_fake_errors && (s_cmp_rd_data_d1 == 8'h07)) ? 2 : 0);
+        end
+    end
+end : p_tester_compare
+
 // Combinatorial logic for the serial flash tester FSM
 always_comb
 begin : p_tester_fsm_comb
@@ -190,7 +232,6 @@ begin : p_tester_fsm_comb
     s_dat_rd_cntidx_val = s_dat_rd_cntidx_aux;
     s_test_pass_val     = s_test_pass_aux;
     s_test_done_val     = s_test_done_aux;
-    s_err_count_val     = s_err_count_aux;
     s_pattern_start_val = s_pattern_start_aux;
     s_pattern_incr_val  = s_pattern_incrval_aux;
     s_pattern_track_val = s_pattern_track_aux;
@@ -202,6 +243,9 @@ begin : p_tester_fsm_comb
     o_sf3_wr_data_stream = 8'h00;
     o_sf3_wr_data_valid  = 1'b0;
 
+    // Default to not passing a read byte to the comparator pipeline stage
+    s_cmp_valid = 1'b0;
+
     case (s_tester_pr_state)
         ST_WAIT_BUTTON_DEP: begin
             // Wait for a button depress or a switch position before
@@ -484,7 +528,7 @@ begin : p_tester_fsm_comb
             o_sf3_cmd_erase_subsector = 1'b0;
             o_sf3_address_of_cmd      = 8'h00000000;
 
-            if (s_t == c_t_max / 2)
+            if (s_t == c_t_hold_half)
                 s_tester_nx_state = ST_CMD_ERASE_START;
             else
                 s_tester_nx_state = ST_SET_START_WAIT_A;
@@ -500,7 +544,7 @@ begin : p_tester_fsm_comb
             o_sf3_cmd_erase_subsector = 1'b0;
             o_sf3_address_of_cmd      = 8'h00000000;
 
-            if (s_t == c_t_max / 2)
+            if (s_t == c_t_hold_half)
                 s_tester_nx_state = ST_CMD_ERASE_START;
             else
                 s_tester_nx_state = ST_SET_START_WAIT_B;
@@ -516,7 +560,7 @@ begin : p_tester_fsm_comb
             o_sf3_cmd_erase_subsector = 1'b0;
             o_sf3_address_of_cmd      = 8'h00000000;
 
-            if (s_t == c_t_max / 2)
+            if (s_t == c_t_hold_half)
                 s_tester_nx_state = ST_CMD_ERASE_START;
             else
                 s_tester_nx_state = ST_SET_START_WAIT_C;
@@ -532,7 +576,7 @@ begin : p_tester_fsm_comb
             o_sf3_cmd_erase_subsector = 1'b0;
             o_sf3_address_of_cmd      = 8'h00000000;
 
-            if (s_t == c_t_max / 2)
+            if (s_t == c_t_hold_half)
                 s_tester_nx_state = ST_CMD_ERASE_START;
             else
                 s_tester_nx_state = ST_SET_START_WAIT_D;
@@ -602,7 +646,7 @@ begin : p_tester_fsm_comb
             s_i_val                   = 0;
             s_pattern_track_val       = s_pattern_start_aux;
 
-            if (s_t == c_t_max) // allow a few seconds of idle for easier SPY capture of the Erase command
+            if (s_t == c_t_hold) // allow a few seconds of idle for easier SPY capture of the Erase command
                 s_tester_nx_state = ST_CMD_PAGE_START;
             else
                 s_tester_nx_state = ST_CMD_ERASE_DONE;
@@ -711,7 +755,7 @@ begin : p_tester_fsm_comb
             s_i_val                   = 0;
             s_pattern_track_val       = s_pattern_start_aux;
 
-            if (s_t == c_t_max) // allow a few seconds of idle for easier SPY capture of the Page command
+            if (s_t == c_t_hold) // allow a few seconds of idle for easier SPY capture of the Page command
                 s_tester_nx_state = ST_CMD_READ_START;
             else
                 s_tester_nx_state = ST_CMD_PAGE_DONE;
@@ -739,9 +783,9 @@ begin : p_tester_fsm_comb
             // Increment according to the selected pattern and stream a
             // total of Page size bytes (256) unique values from the FIFO of
             // the SF3 driver for checking of the currently addressed page
-            // byte read. Compare the value of the incrementing pattern with
-            // the value of the byte read. If they do not match, increment
-            // the error count auxiliary register.
+            // byte read. Pass the value of the incrementing pattern and
+            // the value of the byte read to the comparator pipeline stage,
+            // which increments the error count if they do not match.
             o_sf3_len_random_read     = c_sf3_page_addr_incr;
             o_sf3_cmd_random_read     = 1'b0;
             o_sf3_cmd_page_program    = 1'b0;
@@ -750,12 +794,8 @@ begin : p_tester_fsm_comb
                 s_addr_start_aux + (s_i_aux * c_sf3_page_addr_incr);
 
             if (i_sf3_rd_data_valid) begin
-                // Compare this iterations byte value
-                if (i_sf3_rd_data_stream != s_pattern_track_aux)
-                    s_err_count_val = s_err_count_aux + 1;
-                else // If c_force_fake_errors is non-zero, then fake errors are injected.
-                    s_err_count_val = s_err_count_aux +
-                        ((c_force_fake_errors && (i_sf3_rd_data_stream == 8'h07)) ? 2 : 0);
+                // Pass this iterations byte value to the comparator
+                s_cmp_valid = 1'b1;
 
                 // Calculate the next iterations byte value
                 s_pattern_track_val = s_pattern_track_aux + s_pattern_incrval_aux;
@@ -823,7 +863,7 @@ begin : p_tester_fsm_comb
             s_i_val                   = 0;
             s_pattern_track_val       = s_pattern_start_aux;
 
-            if (s_t == c_t_max) // allow a few seconds of idle for easier SPY capture of the Read command
+            if (s_t == c_t_hold) // allow a few seconds of idle for easier SPY capture of the Read command
                 s_tester_nx_state = ST_DISPLAY_FINAL;
             else
                 s_tester_nx_state = ST_CMD_READ_DONE;
@@ -845,7 +885,7 @@ begin : p_tester_fsm_comb
             else
                 s_test_pass_val = 1'b0;
 
-            if (s_t == c_t_max)
+            if (s_t == c_t_hold)
                 s_tester_nx_state = ST_WAIT_BUTTON_DEP;
             else
                 s_tester_nx_state = ST_DISPLAY_FINAL;
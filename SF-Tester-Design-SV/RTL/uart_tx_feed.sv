@@ -24,14 +24,17 @@
 /**-----------------------------------------------------------------------------
 -- \file uart_tx_feed.sv
 --
--- \brief A simple text byte feeder to the UART TX module.
+-- \brief A simple text byte feeder to the UART TX module, enqueueing a burst of
+--        one or more text lines per pulse at the system clock rate.
 ------------------------------------------------------------------------------*/
 `begin_keywords "1800-2012"
 //Recursive Moore Machine-------------------------------------------------------
 //Part 1: Module header:--------------------------------------------------------
 module uart_tx_feed
     #(parameter
-        parm_ascii_line_length = 35
+        parm_ascii_line_length = 35,
+        // the count of lines enqueued back-to-back per pulse of i_tx_go
+        parm_line_count = 1
         )
     (
         // system clock and reset
@@ -44,8 +47,9 @@ module uart_tx_feed
         input logic i_tx_ready,
         // system pulse to start transmit of a new line
         input logic i_tx_go,
-        // data captured as next 35 character line to transmit
-        input logic [(parm_ascii_line_length*8-1):0] i_dat_ascii_line
+        // data captured as next 35 character lines to transmit, the first line
+        // in the most significant bytes
+        input logic [(parm_line_count*parm_ascii_line_length*8-1):0] i_dat_ascii_line
     );
 
 //Part 2: Declarations----------------------------------------------------------
@@ -63,22 +67,26 @@ typedef enum logic [(`c_uarttx_feed_fsm_bits - 1):0] {
 t_uartfeed_state s_uartfeed_pr_state;
 t_uartfeed_state s_uartfeed_nx_state;
 
+// count of bytes enqueued per burst, and the width of its counter
+localparam integer c_burst_byte_count = parm_line_count * parm_ascii_line_length;
+localparam integer c_uart_k_bits = $clog2(c_burst_byte_count + 1);
+
 // preset values on START
-localparam [5:0] c_uart_k_preset = parm_ascii_line_length;
+localparam [(c_uart_k_bits-1):0] c_uart_k_preset = c_burst_byte_count;
 
-// preset values on reset
-localparam [(parm_ascii_line_length*8-1):0] c_line_of_spaces =
-    280'h2020202020202020202020202020202020202020202020202020202020202020200D0A;
+// preset values on reset, lines of spaces each ended by CR and LF
+localparam [(c_burst_byte_count*8-1):0] c_line_of_spaces =
+    {parm_line_count{{(parm_ascii_line_length-2){8'h20}}, 8'h0D, 8'h0A}};
 
 // UART TX signals for UART TX update FSM
-logic [5:0] s_uart_k_val;
-logic [5:0] s_uart_k_aux;
-logic [(parm_ascii_line_length*8-1):0] s_uart_line_val;
-logic [(parm_ascii_line_length*8-1):0] s_uart_line_aux;
+logic [(c_uart_k_bits-1):0] s_uart_k_val;
+logic [(c_uart_k_bits-1):0] s_uart_k_aux;
+logic [(c_burst_byte_count*8-1):0] s_uart_line_val;
+logic [(c_burst_byte_count*8-1):0] s_uart_line_aux;
 
 //Part 3: Statements------------------------------------------------------------
-// UART TX machine, the \ref parm_ascii_line_length bytes
-// of \ref i_dat_ascii_line
+// UART TX machine, the \ref parm_line_count lines of
+// \ref parm_ascii_line_length bytes of \ref i_dat_ascii_line
 // are feed into out the \ref o_tx_data and \ref o_tx_valid signals.
 // Another module receives the bytes, indicates readiness on signal
 // \ref i_tx_ready .
@@ -110,7 +118,7 @@ begin: p_uartfeed_fsm_nx_out
             // not overflow the UART TX buffer. Once TX is ready,
             // begin the enqueue of outgoing data. TX Ready is presumed to
             // indicate that the TX FIFO is below the threshold of almost
-            // full and that enqueueing the full line will not overflow
+            // full and that enqueueing all of the lines will not overflow
             // the TX FIFO.
             o_tx_data = '0;
             o_tx_valid = 1'b0;
@@ -125,10 +133,10 @@ begin: p_uartfeed_fsm_nx_out
             // \ref s_uart_line_aux. Then transition to the WAIT state.
             // To accomplish this, s_uart_line_aux is shifted left, one byte
             // at-a-time.
-            o_tx_data = s_uart_line_aux[((8*c_uart_k_preset)-1)-:8];
+            o_tx_data = s_uart_line_aux[((8*c_burst_byte_count)-1)-:8];
             o_tx_valid = 1'b1;
             s_uart_k_val = s_uart_k_aux - 1;
-            s_uart_line_val = {s_uart_line_aux[(8*(c_uart_k_preset-1)-1)-:(8*(c_uart_k_preset-1))],8'h00};
+            s_uart_line_val = {s_uart_line_aux[(8*(c_burst_byte_count-1)-1)-:(8*(c_burst_byte_count-1))],8'h00};
 
             if (s_uart_k_aux == 1) s_uartfeed_nx_state = ST_UARTFEED_WAIT;
             else s_uartfeed_nx_state = ST_UARTFEED_DATA;
@@ -26,8 +26,9 @@
 --
 -- \brief A simplified UART function to drive TX characters on a UART board
 --        connection, independent of any RX function (presumed to be ingored).
---        Maximum baudrate is 115200; input clock is 7.37 MHz to support division
---        to modem clock rates.
+--        Input clock is 7.37 MHz to support division to modem clock rates; the
+--        baudrate must divide it evenly, such as 115200, 460800 or 921600.
+--        The FIFO holds many lines, so that bursts of lines are not stalled.
 ------------------------------------------------------------------------------*/
 //------------------------------------------------------------------------------
 `begin_keywords "1800-2012"
@@ -35,12 +36,14 @@
 //Part 1: Module header:--------------------------------------------------------
 module uart_tx_only
     #(parameter
-        // the Modem Baud Rate of the UART TX machine, max 115200
+        // the Modem Baud Rate of the UART TX machine, a divisor of 7372800
         integer parm_BAUD = 115200,
         // the ASCII line length
         integer parm_ascii_line_length = 35,
-        // the almost full threshold for FIFO byte count range 0 to 2047
-        logic [10:0] parm_almost_full_thresh = {3'b111,8'hDC}
+        // the almost full offset of the FIFO, the count of empty bytes at or
+        // below which TX Ready is lowered; one more than the bytes the feed
+        // enqueues per TX Ready
+        logic [10:0] parm_almost_full_thresh = {3'b000,8'h24}
         )
     (
         // system clock
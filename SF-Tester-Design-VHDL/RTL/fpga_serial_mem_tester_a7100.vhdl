@@ -45,7 +45,11 @@ use work.sf_tester_fsm_pkg.all;
 --------------------------------------------------------------------------------
 entity fpga_serial_mem_tester_a7100 is
     generic(
-        parm_fast_simulation : integer := 0
+        parm_fast_simulation      : integer := 0;
+        parm_no_hold              : integer := 0;
+        parm_sf3_fast_sck         : integer := 0;
+        parm_sf3_rx_capture_delay : integer := 3;
+        parm_uart_baud            : integer := 921600
     );
     port(
         -- External clock and active-low reset
@@ -209,8 +213,29 @@ architecture rtl of fpga_serial_mem_tester_a7100 is
     signal si_buttons : std_logic_vector(3 downto 0);
     signal s_btns_deb : std_logic_vector(3 downto 0);
 
+    -- SF3 SPI bus clock, at 5 MHz, or at 10 MHz if the fast SCK is selected,
+    -- which holds the clock enable at the 40 MHz clock.
+    -- The 10 MHz selection is experimental: it has not been simulated or
+    -- verified on the board, and needs the genclk10mhz line of the timing XDC.
+    function fn_sf3_sck_freq(fast_sck : integer) return natural is
+    begin
+        if (fast_sck = 0) then
+            return 5_000_000;
+        else
+            return 10_000_000;
+        end if;
+    end function fn_sf3_sck_freq;
+
+    constant c_sf3_sck_freq : natural := fn_sf3_sck_freq(parm_sf3_fast_sck);
+
     -- SF3 division down from 40 MHz
-    constant c_sf3_tester_ce_div_ratio : natural := (c_FCLK / 5000000 / 4);
+    constant c_sf3_tester_ce_div_ratio : natural := (c_FCLK / c_sf3_sck_freq / 4);
+
+    -- SF3 read-capture delay in 4x clock enables of the SPI FSM state, from 3
+    -- to 7. The default of 3 is the capture point of the 5 MHz clock; no value
+    -- has been validated on the board with the 10 MHz clock of
+    -- parm_sf3_fast_sck, so select the delay for it from a board test.
+    constant c_sf3_rx_capture_delay : natural := parm_sf3_rx_capture_delay;
 
     -- SF3 Tester FSM state outputs
     signal s_sf3_tester_pr_state : t_tester_state;
@@ -228,8 +253,16 @@ architecture rtl of fpga_serial_mem_tester_a7100 is
     signal s_color_led_blue_value  : t_led_color_values((4 - 1) downto 0);
     signal s_basic_led_lumin_value : t_led_color_values((4 - 1) downto 0);
 
-    -- UART TX signals to connect \ref uart_tx_only and \ref uart_tx_feed .
-    signal s_uart_txt_ascii_line : std_logic_vector((35*8-1) downto 0);
+    -- UART TX signals to connect \ref uart_tx_only and \ref uart_tx_feed ,
+    -- with the almost full offset of the UART TX FIFO one more than the bytes
+    -- of the lines that the feed enqueues per TX Ready.
+    constant c_uart_ascii_line_length  : natural := 35;
+    constant c_uart_line_count         : natural := 1;
+    constant c_uart_almost_full_thresh : bit_vector(10 downto 0) :=
+        to_bitvector(std_logic_vector(to_unsigned(
+        c_uart_line_count * c_uart_ascii_line_length + 1, 11)));
+
+    signal s_uart_txt_ascii_line : std_logic_vector((c_uart_line_count*c_uart_ascii_line_length*8-1) downto 0);
     signal s_uart_tx_go          : std_logic;
     signal s_uart_txdata         : std_logic_vector(7 downto 0);
     signal s_uart_txvalid        : std_logic;
@@ -461,6 +494,7 @@ begin
             parm_fast_simulation   => parm_fast_simulation,
             parm_FCLK              => c_FCLK,
             parm_ext_spi_clk_ratio => (c_sf3_tester_ce_div_ratio * 4),
+            parm_rx_capture_delay  => c_sf3_rx_capture_delay,
             parm_tx_len_bits       => c_quad_spi_tx_fifo_count_bits,
             parm_wait_cyc_bits     => c_quad_spi_wait_count_bits,
             parm_rx_len_bits       => c_quad_spi_rx_fifo_count_bits
@@ -521,6 +555,7 @@ begin
     u_sf_tester_fsm : entity work.sf_tester_fsm(rtl)
         generic map (
             parm_fast_simulation         => parm_fast_simulation,
+            parm_no_hold                 => parm_no_hold,
             parm_FCLK                    => c_FCLK,
             parm_sf3_tester_ce_div_ratio => c_sf3_tester_ce_div_ratio,
             parm_pattern_startval_a      => c_tester_pattern_startval_a,
@@ -626,7 +661,9 @@ begin
 
     u_uart_tx_only : entity work.uart_tx_only(moore_fsm_recursive)
         generic map (
-            parm_BAUD => 115200
+            parm_BAUD               => parm_uart_baud,
+            parm_ascii_line_length  => c_uart_ascii_line_length,
+            parm_almost_full_thresh => c_uart_almost_full_thresh
         )
         port map (
             i_clk_40mhz   => s_clk_40mhz,
@@ -640,6 +677,10 @@ begin
         );
 
     u_uart_tx_feed : entity work.uart_tx_feed(rtl)
+        generic map (
+            parm_ascii_line_length => c_uart_ascii_line_length,
+            parm_line_count        => c_uart_line_count
+        )
         port map (
             i_clk_40mhz      => s_clk_40mhz,
             i_rst_40mhz      => s_rst_40mhz,
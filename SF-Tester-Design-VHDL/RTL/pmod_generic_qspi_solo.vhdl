@@ -46,6 +46,11 @@ entity pmod_generic_qspi_solo is
     generic(
         -- Ratio of i_ext_spi_clk_x to SPI sck bus output.
         parm_ext_spi_clk_ratio : natural := 32;
+        -- Count of 4x clock enables that the RX capture lags the SPI FSM
+        -- state, covering the registration of outputs, the round trip through
+        -- the pads and the peripheral, and the double registration of inputs.
+        -- Valid values are 3 through 7.
+        parm_rx_capture_delay : natural := 3;
         -- LOG2 of the TX FIFO max count
         parm_tx_len_bits : natural := 9;
         -- LOG2 of max Wait Cycles count between end of TX and start of RX
@@ -109,9 +114,8 @@ architecture spi_hybrid_fsm of pmod_generic_qspi_solo is
 
     signal s_spi_pr_state                      : t_spi_state := ST_IDLE_ENHAN;
     signal s_spi_nx_state                      : t_spi_state := ST_IDLE_ENHAN;
-    signal s_spi_pr_state_delayed1             : t_spi_state := ST_IDLE_ENHAN;
-    signal s_spi_pr_state_delayed2             : t_spi_state := ST_IDLE_ENHAN;
-    signal s_spi_pr_state_delayed3             : t_spi_state := ST_IDLE_ENHAN;
+    type t_spi_state_delayed is array (1 to parm_rx_capture_delay) of t_spi_state;
+    signal s_spi_pr_state_delayed              : t_spi_state_delayed := (others => ST_IDLE_ENHAN);
 
     -- Xilinx attributes for gray encoding of the FSM and safe state is
     -- Default State.
@@ -140,10 +144,10 @@ architecture spi_hybrid_fsm of pmod_generic_qspi_solo is
 
     constant c_tmax : natural := c_t_enhan_max_tx - 1;
 
-    signal s_t          : natural range 0 to c_tmax;
-    signal s_t_delayed1 : natural range 0 to c_tmax;
-    signal s_t_delayed2 : natural range 0 to c_tmax;
-    signal s_t_delayed3 : natural range 0 to c_tmax;
+    type t_t_delayed is array (1 to parm_rx_capture_delay) of natural range 0 to c_tmax;
+
+    signal s_t         : natural range 0 to c_tmax;
+    signal s_t_delayed : t_t_delayed;
 
     signal s_t_inc : natural range 1 to 4;
 
@@ -155,6 +159,7 @@ architecture spi_hybrid_fsm of pmod_generic_qspi_solo is
     signal s_spi_clk_ce1 : std_logic;
     signal s_spi_clk_ce2 : std_logic;
     signal s_spi_clk_ce3 : std_logic;
+    signal s_spi_clk_ce_rx : std_logic;
 
     -- FSM pulse stretched
     signal s_go_enhan  : std_logic;
@@ -380,21 +385,24 @@ begin
     s_spi_clk_ce2 <= '1' when (v_phase_counter = parm_ext_spi_clk_ratio / 4 * 2) and (s_spi_ce_4x = '1') else '0';
     s_spi_clk_ce3 <= '1' when (v_phase_counter = parm_ext_spi_clk_ratio / 4 * 3) and (s_spi_ce_4x = '1') else '0';
 
+    -- Read-capture clock enable, at the 25% point that the delayed FSM state
+    -- reaches its second 4x clock enable, as CE 3 does for the default delay of 3.
+    s_spi_clk_ce_rx <= '1' when (v_phase_counter =
+        parm_ext_spi_clk_ratio / 4 * (parm_rx_capture_delay mod 4)) and (s_spi_ce_4x = '1') else '0';
+
     -- Timer 1 (Strategy #1) with modifiable timer increment
     p_timer_1 : process(i_ext_spi_clk_x)
     begin
         if rising_edge(i_ext_spi_clk_x) then
             if (i_srst = '1') then
                 s_t          <= 0;
-                s_t_delayed1 <= 0;
-                s_t_delayed2 <= 0;
-                s_t_delayed3 <= 0;
+                s_t_delayed  <= (others => 0);
                 s_t_inc      <= 1;
             else
                 if (i_spi_ce_4x = '1') then
-                    s_t_delayed3 <= s_t_delayed2;
-                    s_t_delayed2 <= s_t_delayed1;
-                    s_t_delayed1 <= s_t;
+                    s_t_delayed(2 to parm_rx_capture_delay) <=
+                        s_t_delayed(1 to parm_rx_capture_delay - 1);
+                    s_t_delayed(1) <= s_t;
                 end if;
 
                 -- clock enable on falling SPIedge
@@ -498,9 +506,7 @@ begin
     begin
         if rising_edge(i_ext_spi_clk_x) then
             if (i_srst = '1') then
-                s_spi_pr_state_delayed3 <= ST_IDLE_ENHAN;
-                s_spi_pr_state_delayed2 <= ST_IDLE_ENHAN;
-                s_spi_pr_state_delayed1 <= ST_IDLE_ENHAN;
+                s_spi_pr_state_delayed  <= (others => ST_IDLE_ENHAN);
                 s_spi_pr_state          <= ST_IDLE_ENHAN;
 
             else
@@ -508,9 +514,9 @@ begin
                     -- the delayed state value allows for registration of TX clock
                     -- and double registration of RX value to capture after the
                     -- registration of outputs and synchronization of inputs
-                    s_spi_pr_state_delayed3 <= s_spi_pr_state_delayed2;
-                    s_spi_pr_state_delayed2 <= s_spi_pr_state_delayed1;
-                    s_spi_pr_state_delayed1 <= s_spi_pr_state;
+                    s_spi_pr_state_delayed(2 to parm_rx_capture_delay) <=
+                        s_spi_pr_state_delayed(1 to parm_rx_capture_delay - 1);
+                    s_spi_pr_state_delayed(1) <= s_spi_pr_state;
                 end if;
 
                 if (s_spi_clk_ce2 = '1') then -- clock enable on falling SPI edge
@@ -778,13 +784,16 @@ begin
     end process p_spi_fsm_comb;
 
     -- Captures the RX inputs into the RX fifo.
-    -- Note that the RX inputs are delayed by 3 clk_4x clock cycles.
+    -- Note that the RX inputs are delayed by 3 clk_4x clock cycles by default.
     -- Before the delay, the falling edge would occur at the capture of
     -- clock enable 0; but with the delay of registering output and double
     -- registering input, the FSM state is delayed by 3 clock cycles for
     -- RX only and the clock enable to process on the effective falling edge of
     -- the bus SCK as perceived from propagation out and back in, is 3 clock
-    -- cycles, thus CE 3 instead of CE 0.
+    -- cycles, thus CE 3 instead of CE 0. At a faster SCK, the propagation out
+    -- and back in is a larger part of the SCK period, and the capture can be
+    -- delayed further by parm_rx_capture_delay, with the capture clock
+    -- enable following it.
     p_spi_fsm_inputs : process(i_ext_spi_clk_x)
     begin
         if rising_edge(i_ext_spi_clk_x) then
@@ -792,15 +801,15 @@ begin
                 s_data_fifo_rx_we             <= '0';
                 s_data_fifo_rx_in(7 downto 0) <= x"00";
             else
-                if (s_spi_clk_ce3 = '1') then
-                    if (s_spi_pr_state_delayed3 = ST_RX_ENHAN) then
+                if (s_spi_clk_ce_rx = '1') then
+                    if (s_spi_pr_state_delayed(parm_rx_capture_delay) = ST_RX_ENHAN) then
                         -- input current byte to enqueue, one bit at a time, shifting
                         s_data_fifo_rx_in <= s_data_fifo_rx_in(6 downto 0) & eio_cipo_dq1_i when
-                            (s_t_delayed3 < (8 * s_rx_len_aux)) else x"00";
+                            (s_t_delayed(parm_rx_capture_delay) < (8 * s_rx_len_aux)) else x"00";
 
                         -- only if on last bit, enqueue another byte
                         -- only if RX FIFO is not full, enqueue another byte
-                        s_data_fifo_rx_we <= '1' when ((s_t_delayed3 mod 8 = 7) and
+                        s_data_fifo_rx_we <= '1' when ((s_t_delayed(parm_rx_capture_delay) mod 8 = 7) and
                             (s_data_fifo_rx_full = '0')) else '0';
                     else
                         s_data_fifo_rx_we <= '0';
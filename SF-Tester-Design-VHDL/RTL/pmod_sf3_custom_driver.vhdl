@@ -45,6 +45,9 @@ entity pmod_sf3_custom_driver is
         parm_FCLK : natural := 20_000_000;
         -- Ratio of i_ext_spi_clk_x to SPI sck bus output. */
         parm_ext_spi_clk_ratio : integer := 32;
+        -- Count of 4x clock enables that the RX capture lags the SPI FSM
+        -- state in \ref pmod_generic_qspi_solo .
+        parm_rx_capture_delay : natural := 3;
         -- LOG2 of the TX FIFO max count
         parm_tx_len_bits : natural := 9;
         -- LOG2 of max Wait Cycles count between end of TX and start of RX
@@ -130,6 +133,14 @@ architecture rtl of pmod_sf3_custom_driver is
     signal sio_dq3_sync_i : std_logic;
     signal sio_dq3_meta_i : std_logic;
 
+    -- Xilinx attributes for packing the first stage of the input
+    -- synchronizers into the input registers of the pads.
+    attribute IOB                   : string;
+    attribute IOB of sio_dq0_meta_i : signal is "TRUE";
+    attribute IOB of sio_dq1_meta_i : signal is "TRUE";
+    attribute IOB of sio_dq2_meta_i : signal is "TRUE";
+    attribute IOB of sio_dq3_meta_i : signal is "TRUE";
+
     -- system SPI control signals and data
     signal s_go_enhan   : std_logic;
     signal s_go_quadio  : std_logic;
@@ -177,7 +188,8 @@ begin
 
     -- Two-stage synchronize the SPI FSM inputs for best practice.
     -- Note that the QSPI driver assumes this with its clock-enable phase
-    -- timings.
+    -- timings. The first stage is packed into the input register of the pad,
+    -- so that the read-capture timing does not vary with placement.
     p_sync_spi_in : process(i_clk_mhz)
     begin
         if rising_edge(i_clk_mhz) then
@@ -243,6 +255,7 @@ begin
     u_pmod_generic_qspi_solo : entity work.pmod_generic_qspi_solo(spi_hybrid_fsm)
         generic map(
             parm_ext_spi_clk_ratio => parm_ext_spi_clk_ratio,
+            parm_rx_capture_delay  => parm_rx_capture_delay,
             parm_tx_len_bits       => parm_tx_len_bits,
             parm_wait_cyc_bits     => parm_wait_cyc_bits,
             parm_rx_len_bits       => parm_rx_len_bits
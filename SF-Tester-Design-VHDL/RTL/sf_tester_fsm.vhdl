@@ -40,6 +40,12 @@ package sf_tester_fsm_pkg is
     function fn_set_t_max(fclk : natural; div_ratio : natural; fast_sim : integer)
         return natural;
 
+    -- Function to determine the hold count of timer T for a phase transition
+    -- based upon whether the holds are disabled. If not holding, the return is
+    -- zero, and the transition occurs on the first clock enable of the state.
+    function fn_set_t_hold(t_hold : natural; no_hold : integer)
+        return natural;
+
     -- The Tester FSM states definition
     type t_tester_state is (ST_WAIT_BUTTON_DEP, ST_WAIT_BUTTON0_REL,
             ST_WAIT_BUTTON1_REL, ST_WAIT_BUTTON2_REL, ST_WAIT_BUTTON3_REL,
@@ -95,6 +101,16 @@ package body sf_tester_fsm_pkg is
             return fclk / div_ratio * 3 / 1000 - 1; -- three millisecond delay count
         end if;
     end function fn_set_t_max;
+
+    function fn_set_t_hold(t_hold : natural; no_hold : integer)
+        return natural is
+    begin
+        if (no_hold = 0) then
+            return t_hold;
+        else
+            return 0;
+        end if;
+    end function fn_set_t_hold;
 end package body;
 --------------------------------------------------------------------------------
 
@@ -112,6 +128,11 @@ entity sf_tester_fsm is
         -- synthesis timing for the purpose of displaying SPI bus with a visual
         -- testbench.
         parm_fast_simulation         : natural := 0;
+        -- define as non-zero to skip the timed holds between the erase,
+        -- program, and read phases, running the tester at the throughput of
+        -- the N25Q flash instead of pausing for display and SPY capture.
+        -- Not yet simulated; see the README.
+        parm_no_hold                 : natural := 0;
         -- Frequency of the clock
         parm_FCLK                    : natural := 40_000_000;
         -- Ratio of the clock enable to the clock
@@ -166,6 +187,10 @@ architecture rtl of sf_tester_fsm is
     -- for hardware execution.
     constant c_t_max : natural := fn_set_t_max(parm_FCLK, parm_sf3_tester_ce_div_ratio, parm_fast_simulation);
 
+    -- Hold counts of the phase transitions, zero if the holds are disabled.
+    constant c_t_hold      : natural := fn_set_t_hold(c_t_max, parm_no_hold);
+    constant c_t_hold_half : natural := fn_set_t_hold(c_t_max / 2, parm_no_hold);
+
     -- Timer variable
     signal s_t : natural range 0 to c_t_max;
 
@@ -182,8 +207,6 @@ architecture rtl of sf_tester_fsm is
     signal s_test_pass_aux     : std_logic;
     signal s_test_done_val     : std_logic;
     signal s_test_done_aux     : std_logic;
-    signal s_err_count_val     : natural range 0 to parm_max_possible_byte_count;
-    signal s_err_count_aux     : natural range 0 to parm_max_possible_byte_count;
     signal s_pattern_start_val   : std_logic_vector(7 downto 0);
     signal s_pattern_start_aux   : std_logic_vector(7 downto 0);
     signal s_pattern_incr_val    : std_logic_vector(7 downto 0);
@@ -197,6 +220,13 @@ architecture rtl of sf_tester_fsm is
     signal s_i_val               : natural range 0 to c_tester_page_cnt_per_iter;
     signal s_i_aux               : natural range 0 to c_tester_page_cnt_per_iter;
 
+    -- Comparator pipeline stage registers
+    signal s_cmp_valid      : std_logic;
+    signal s_cmp_valid_d1   : std_logic;
+    signal s_cmp_rd_data_d1 : std_logic_vector(7 downto 0);
+    signal s_cmp_expect_d1  : std_logic_vector(7 downto 0);
+    signal s_err_count_aux  : natural range 0 to parm_max_possible_byte_count;
+
     constant c_force_fake_errors : boolean := false;
 begin
     -- Outputs for other modules to read
@@ -235,7 +265,6 @@ begin
                 s_dat_rd_cntidx_aux   <= 0;
                 s_test_pass_aux       <= '0';
                 s_test_done_aux       <= '0';
-                s_err_count_aux       <= 0;
                 s_pattern_start_aux   <= std_logic_vector(parm_pattern_startval_a);
                 s_pattern_incrval_aux <= std_logic_vector(parm_pattern_incrval_a);
                 s_pattern_track_aux   <= x"00";
@@ -250,7 +279,6 @@ begin
                 s_dat_rd_cntidx_aux   <= s_dat_rd_cntidx_val;
                 s_test_pass_aux       <= s_test_pass_val;
                 s_test_done_aux       <= s_test_done_val;
-                s_err_count_aux       <= s_err_count_val;
                 s_pattern_start_aux   <= s_pattern_start_val;
                 s_pattern_incrval_aux <= s_pattern_incr_val;
                 s_pattern_track_aux   <= s_pattern_track_val;
@@ -261,6 +289,39 @@ begin
         end if;
     end process p_tester_fsm_state;
 
+    -- Comparator pipeline stage for the serial flash tester FSM. The byte read
+    -- from the SF3 driver FIFO and the expected pattern byte are registered on
+    -- the clock enable that the FSM accepts them, and compared on the next clock
+    -- enable, so that the FIFO output is not in the same path as the error
+    -- counter adder. The error count settles one clock enable after the last
+    -- byte of a page, well before the FSM reaches ST_DISPLAY_FINAL.
+    p_tester_compare : process(i_clk_40mhz)
+    begin
+        if rising_edge(i_clk_40mhz) then
+            if (i_rst_40mhz = '1') then
+                s_cmp_valid_d1   <= '0';
+                s_cmp_rd_data_d1 <= x"00";
+                s_cmp_expect_d1  <= x"00";
+                s_err_count_aux  <= 0;
+
+            elsif (i_ce_div = '1') then
+                s_cmp_valid_d1   <= s_cmp_valid;
+                s_cmp_rd_data_d1 <= i_sf3_rd_data_stream;
+                s_cmp_expect_d1  <= s_pattern_track_aux;
+
+                if (s_cmp_valid_d1 = '1') then
+                    -- Compare the byte value registered on the prior clock enable
+                    if (s_cmp_rd_data_d1 /= s_cmp_expect_d1) then
+                        s_err_count_aux <= s_err_count_aux + 1;
+                    elsif (c_force_fake_errors and (s_cmp_rd_data_d1 = x"07")) then
+                        -- If c_force_fake_errors is non-zero, then fake errors are injected.
+                        s_err_count_aux <= s_err_count_aux + 2;
+                    end if;
+                end if;
+            end if;
+        end if;
+    end process p_tester_compare;
+
     -- Combinatorial logic for the serial flash tester FSM
     p_tester_fsm_comb : process(
             s_tester_pr_state,
@@ -268,7 +329,6 @@ begin
             i_sf3_wr_data_ready,
             i_sf3_command_ready,
             i_sf3_rd_data_valid,
-            i_sf3_rd_data_stream,
             s_dat_wr_cntidx_aux,
             s_dat_rd_cntidx_aux,
             s_test_pass_aux,
@@ -287,7 +347,6 @@ begin
         s_dat_rd_cntidx_val <= s_dat_rd_cntidx_aux;
         s_test_pass_val     <= s_test_pass_aux;
         s_test_done_val     <= s_test_done_aux;
-        s_err_count_val     <= s_err_count_aux;
         s_pattern_start_val <= s_pattern_start_aux;
         s_pattern_incr_val  <= s_pattern_incrval_aux;
         s_pattern_track_val <= s_pattern_track_aux;
@@ -299,6 +358,9 @@ begin
         o_sf3_wr_data_stream <= x"00";
         o_sf3_wr_data_valid  <= '0';
 
+        -- Default to not passing a read byte to the comparator pipeline stage
+        s_cmp_valid <= '0';
+
         case (s_tester_pr_state) is
 
             when ST_WAIT_BUTTON_DEP =>
@@ -583,7 +645,7 @@ begin
                 o_sf3_cmd_erase_subsector <= '0';
                 o_sf3_address_of_cmd      <= (others => '0');
 
-                if (s_t = c_t_max / 2) then
+                if (s_t = c_t_hold_half) then
                     s_tester_nx_state <= ST_CMD_ERASE_START;
                 else
                     s_tester_nx_state <= ST_SET_START_WAIT_A;
@@ -599,7 +661,7 @@ begin
                 o_sf3_cmd_erase_subsector <= '0';
                 o_sf3_address_of_cmd      <= (others => '0');
 
-                if (s_t = c_t_max / 2) then
+                if (s_t = c_t_hold_half) then
                     s_tester_nx_state <= ST_CMD_ERASE_START;
                 else
                     s_tester_nx_state <= ST_SET_START_WAIT_B;
@@ -615,7 +677,7 @@ begin
                 o_sf3_cmd_erase_subsector <= '0';
                 o_sf3_address_of_cmd      <= (others => '0');
 
-                if (s_t = c_t_max / 2) then
+                if (s_t = c_t_hold_half) then
                     s_tester_nx_state <= ST_CMD_ERASE_START;
                 else
                     s_tester_nx_state <= ST_SET_START_WAIT_C;
@@ -631,7 +693,7 @@ begin
                 o_sf3_cmd_erase_subsector <= '0';
                 o_sf3_address_of_cmd      <= (others => '0');
 
-                if (s_t = c_t_max / 2) then
+                if (s_t = c_t_hold_half) then
                     s_tester_nx_state <= ST_CMD_ERASE_START;
                 else
                     s_tester_nx_state <= ST_SET_START_WAIT_D;
@@ -703,7 +765,7 @@ begin
                 s_i_val                   <= 0;
                 s_pattern_track_val       <= s_pattern_start_aux;
 
-                if (s_t = c_t_max) then -- allow a few seconds of idle for easier SPY capture of the Erase command
+                if (s_t = c_t_hold) then -- allow a few seconds of idle for easier SPY capture of the Erase command
                     s_tester_nx_state <= ST_CMD_PAGE_START;
                 else
                     s_tester_nx_state <= ST_CMD_ERASE_DONE;
@@ -817,7 +879,7 @@ begin
                 s_i_val                   <= 0;
                 s_pattern_track_val       <= s_pattern_start_aux;
 
-                if (s_t = c_t_max) then -- allow a few seconds of idle for easier SPY capture of the Page command
+                if (s_t = c_t_hold) then -- allow a few seconds of idle for easier SPY capture of the Page command
                     s_tester_nx_state <= ST_CMD_READ_START;
                 else
                     s_tester_nx_state <= ST_CMD_PAGE_DONE;
@@ -847,9 +909,9 @@ begin
                 -- Increment according to the selected pattern and stream a
                 -- total of Page size bytes (256) unique values from the FIFO of
                 -- the SF3 driver for checking of the currently addressed page
-                -- byte read. Compare the value of the incrementing pattern with
-                -- the value of the byte read. If they do not match, increment
-                -- the error count auxiliary register.
+                -- byte read. Pass the value of the incrementing pattern and
+                -- the value of the byte read to the comparator pipeline stage,
+                -- which increments the error count if they do not match.
                 o_sf3_len_random_read <= std_logic_vector(
                         to_unsigned(c_sf3_page_addr_incr, o_sf3_len_random_read'length));
                 o_sf3_cmd_random_read     <= '0';
@@ -860,13 +922,8 @@ begin
                         (s_i_aux * c_sf3_page_addr_incr));
 
                 if (i_sf3_rd_data_valid = '1') then
-                    -- Compare this iterations byte value
-                    if (i_sf3_rd_data_stream /= s_pattern_track_aux) then
-                        s_err_count_val <= s_err_count_aux + 1;
-                    elsif (c_force_fake_errors and (i_sf3_rd_data_stream = x"07")) then
-                        -- If c_force_fake_errors is non-zero, then fake errors are injected.
-                        s_err_count_val <= s_err_count_aux + 2;
-                    end if;
+                    -- Pass this iterations byte value to the comparator
+                    s_cmp_valid <= '1';
 
                     -- Calculate the next iterations byte value
                     s_pattern_track_val <= std_logic_vector(
@@ -939,7 +996,7 @@ begin
                 s_i_val                   <= 0;
                 s_pattern_track_val       <= s_pattern_start_aux;
 
-                if (s_t = c_t_max) then -- allow a few seconds of idle for easier SPY capture of the Read command
+                if (s_t = c_t_hold) then -- allow a few seconds of idle for easier SPY capture of the Read command
                     s_tester_nx_state <= ST_DISPLAY_FINAL;
                 else
                     s_tester_nx_state <= ST_CMD_READ_DONE;
@@ -962,7 +1019,7 @@ begin
                     s_test_pass_val <= '0';
                 end if;
 
-                if (s_t = c_t_max) then
+                if (s_t = c_t_hold) then
                     s_tester_nx_state <= ST_WAIT_BUTTON_DEP;
                 else
                     s_tester_nx_state <= ST_DISPLAY_FINAL;
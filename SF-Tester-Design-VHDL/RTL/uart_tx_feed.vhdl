@@ -23,7 +23,8 @@
 --------------------------------------------------------------------------------
 -- \file uart_tx_feed.vhdl
 --
--- \brief A simple text byte feeder to the UART TX module.
+-- \brief A simple text byte feeder to the UART TX module, enqueueing a burst of
+--        one or more text lines per pulse at the system clock rate.
 --------------------------------------------------------------------------------
 library ieee;
 use ieee.std_logic_1164.all;
@@ -34,7 +35,9 @@ library work;
 entity uart_tx_feed is
     generic(
         -- the ASCII line length
-        parm_ascii_line_length : natural := 35
+        parm_ascii_line_length : natural := 35;
+        -- the count of lines enqueued back-to-back per pulse of i_tx_go
+        parm_line_count : natural := 1
     );
     port(
         -- system clock and reset
@@ -47,8 +50,9 @@ entity uart_tx_feed is
         i_tx_ready       : in  std_logic;
         -- system pulse to start transmit of a new line
         i_tx_go          : in  std_logic;
-        -- data captured as next 35 character line to transmit
-        i_dat_ascii_line : in  std_logic_vector((parm_ascii_line_length*8-1) downto 0)
+        -- data captured as next 35 character lines to transmit, the first line
+        -- in the most significant bytes
+        i_dat_ascii_line : in  std_logic_vector((parm_line_count*parm_ascii_line_length*8-1) downto 0)
     );
 end entity uart_tx_feed;
 --------------------------------------------------------------------------------
@@ -63,22 +67,46 @@ architecture rtl of uart_tx_feed is
     signal s_uartfeed_pr_state : t_uarttx_feed_state;
     signal s_uartfeed_nx_state : t_uarttx_feed_state;
 
+    -- count of bytes enqueued per burst
+    constant c_burst_byte_count : natural := parm_line_count * parm_ascii_line_length;
+
     -- UART feed FSM auxliary registers
-    signal s_uart_k_val    : natural range 0 to 63;
-    signal s_uart_k_aux    : natural range 0 to 63;
-    signal s_uart_line_val : std_logic_vector((parm_ascii_line_length*8-1) downto 0);
-    signal s_uart_line_aux : std_logic_vector((parm_ascii_line_length*8-1) downto 0);
+    signal s_uart_k_val    : natural range 0 to c_burst_byte_count;
+    signal s_uart_k_aux    : natural range 0 to c_burst_byte_count;
+    signal s_uart_line_val : std_logic_vector((c_burst_byte_count*8-1) downto 0);
+    signal s_uart_line_aux : std_logic_vector((c_burst_byte_count*8-1) downto 0);
 
     -- preset values on START
-    constant c_uart_k_preset : natural := parm_ascii_line_length;
+    constant c_uart_k_preset : natural := c_burst_byte_count;
+
+    -- Lines of spaces, each ended by CR and LF, with the first byte in the
+    -- most significant bits.
+    function fn_lines_of_spaces return std_logic_vector is
+        variable v_lines : std_logic_vector((c_burst_byte_count*8-1) downto 0);
+        variable v_col   : natural;
+    begin
+        for i in 0 to (c_burst_byte_count - 1) loop
+            v_col := i mod parm_ascii_line_length;
+
+            if (v_col = parm_ascii_line_length - 2) then
+                v_lines((8 * (c_burst_byte_count - i) - 1) downto (8 * (c_burst_byte_count - i - 1))) := x"0D";
+            elsif (v_col = parm_ascii_line_length - 1) then
+                v_lines((8 * (c_burst_byte_count - i) - 1) downto (8 * (c_burst_byte_count - i - 1))) := x"0A";
+            else
+                v_lines((8 * (c_burst_byte_count - i) - 1) downto (8 * (c_burst_byte_count - i - 1))) := x"20";
+            end if;
+        end loop;
+
+        return v_lines;
+    end function fn_lines_of_spaces;
 
     -- preset values on reset
-    constant c_line_of_spaces : std_logic_vector((parm_ascii_line_length*8-1) downto 0) :=
-        x"2020202020202020202020202020202020202020202020202020202020202020200D0A";
+    constant c_line_of_spaces : std_logic_vector((c_burst_byte_count*8-1) downto 0) :=
+        fn_lines_of_spaces;
 
 begin
-    -- UART TX machine, the \ref parm_ascii_line_length bytes
-    -- of \ref i_dat_ascii_line
+    -- UART TX machine, the \ref parm_line_count lines of
+    -- \ref parm_ascii_line_length bytes of \ref i_dat_ascii_line
     -- are feed into out the \ref o_tx_data and \ref o_tx_valid signals.
     -- Another module receives the bytes, indicates readiness on signal
     -- \ref i_tx_ready .
@@ -112,7 +140,7 @@ begin
                 -- not overflow the UART TX buffer. Once TX is ready,
                 -- begin the enqueue of outgoing data. TX Ready is presumed to
                 -- indicate that the TX FIFO is below the threshold of almost
-                -- full and that enqueueing the full line will not overflow
+                -- full and that enqueueing all of the lines will not overflow
                 -- the TX FIFO.
                 o_tx_data       <= x"00";
                 o_tx_valid      <= '0';
@@ -25,8 +25,9 @@
 --
 -- \brief A simplified UART function to drive TX characters on a UART board
 --        connection, independent of any RX function (presumed to be ingored).
---        Maximum baudrate is 115200; input clock is 7.37 MHz to support division
---        to modem clock rates.
+--        Input clock is 7.37 MHz to support division to modem clock rates; the
+--        baudrate must divide it evenly, such as 115200, 460800 or 921600.
+--        The FIFO holds many lines, so that bursts of lines are not stalled.
 --------------------------------------------------------------------------------
 library ieee;
 use ieee.std_logic_1164.all;
@@ -42,12 +43,14 @@ library work;
 --------------------------------------------------------------------------------
 entity uart_tx_only is
     generic(
-        -- the Modem Baud Rate of the UART TX machine, max 115200
+        -- the Modem Baud Rate of the UART TX machine, a divisor of 7372800
         parm_BAUD : natural := 115200;
         -- the ASCII line length
         parm_ascii_line_length : natural := 35;
-        -- the almost full threshold for FIFO byte count range 0 to 2047
-        parm_almost_full_thresh : bit_vector(10 downto 0) := "111" & x"dc"
+        -- the almost full offset of the FIFO, the count of empty bytes at or
+        -- below which TX Ready is lowered; one more than the bytes the feed
+        -- enqueues per TX Ready
+        parm_almost_full_thresh : bit_vector(10 downto 0) := "000" & x"24"
     );
     port(
         -- system clock
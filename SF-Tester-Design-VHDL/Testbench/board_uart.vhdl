@@ -40,6 +40,9 @@ use work.sf3_testbench_types_pkg.all;
 use work.sf3_testbench_pkg.all;
 --------------------------------------------------------------------------------
 entity tbc_board_uart is
+	generic(
+		parm_uart_baud : natural := 921600
+	);
 	port(
 		TBID             : in    AlertLogIDType;
 		BarrierTestStart : inout std_logic;
@@ -66,7 +69,8 @@ begin
 		wait on ModelID;
 		SB_CLS.SetAlertLogID("MeasModeBoardUart", ModelID);
 
-		Log(ModelID, "Starting Board UART emulation at baud 115200.", ALWAYS);
+		Log(ModelID, "Starting Board UART emulation at baud " &
+			integer'image(parm_uart_baud) & ".", ALWAYS);
 		wait;
 	end process p_sim_init;
 
@@ -41,6 +41,9 @@ entity fpga_serial_mem_tester_testbench is
 	generic(
 		parm_simulation_duration : time    := 7 ms;
 		parm_fast_simulation     : integer := 1;
+		parm_no_hold             : integer := 0;
+		parm_sf3_fast_sck        : integer := 0;
+		parm_uart_baud           : natural := 921600;
 		parm_log_file_name       : string  := "log_fpga_serial_mem_tester_no_test.txt"
 	);
 end entity fpga_serial_mem_tester_testbench;
@@ -48,7 +51,10 @@ end entity fpga_serial_mem_tester_testbench;
 architecture simulation of fpga_serial_mem_tester_testbench is
 	component fpga_serial_mem_tester is
 		generic(
-			parm_fast_simulation : integer := 0
+			parm_fast_simulation : integer := 0;
+			parm_no_hold         : integer := 0;
+			parm_sf3_fast_sck    : integer := 0;
+			parm_uart_baud       : integer := 921600
 		);
 		port(
 			-- Board clock
@@ -155,6 +161,9 @@ architecture simulation of fpga_serial_mem_tester_testbench is
 	end component tbc_pmod_cls;
 
 	component tbc_board_uart is
+		generic(
+			parm_uart_baud : natural := 921600
+		);
 		port(
 			TBID             : in    AlertLogIDType;
 			BarrierTestStart : inout std_logic;
@@ -281,7 +290,10 @@ begin
 	-- Unit Under Test: fpga_serial_mem_tester
 	uut_fpga_serial_mem_tester : fpga_serial_mem_tester
 		generic map (
-			parm_fast_simulation => parm_fast_simulation)
+			parm_fast_simulation => parm_fast_simulation,
+			parm_no_hold         => parm_no_hold,
+			parm_sf3_fast_sck    => parm_sf3_fast_sck,
+			parm_uart_baud       => parm_uart_baud)
 		port map (
 			CLK100MHZ             => CLK100MHZ,
 			i_resetn              => si_resetn,
@@ -418,6 +430,9 @@ begin
 
 	-- Simulate the board UART peripheral
 	u_tbc_board_uart : tbc_board_uart
+		generic map(
+			parm_uart_baud => parm_uart_baud
+		)
 		port map(
 			TBID             => TBID,
 			BarrierTestStart => s_barrier_test_start,
@@ -430,7 +445,7 @@ begin
 	-- Use the OSVVM UART for checking the UART RXD line
 	u_osvvm_uart_rx : entity osvvm_uart.UartRx
 		generic map(
-			DEFAULT_BAUD          => UART_BAUD_PERIOD_115200,
+			DEFAULT_BAUD          => (1 sec / parm_uart_baud),
 			DEFAULT_NUM_DATA_BITS => UARTTB_DATA_BITS_8,
 			DEFAULT_PARITY_MODE   => UARTTB_PARITY_NONE,
 			DEFAULT_NUM_STOP_BITS => UARTTB_STOP_BITS_1
@@ -39,6 +39,9 @@ architecture simulation of fpga_serial_mem_tester_testharness is
         generic(
             parm_simulation_duration : time := 7 ms;
             parm_fast_simulation : integer := 1;
+            parm_no_hold : integer := 0;
+            parm_sf3_fast_sck : integer := 0;
+            parm_uart_baud : natural := 921600;
             parm_log_file_name : string := "log_fpga_serial_mem_tester_no_test.txt"
         );
     end component fpga_serial_mem_tester_testbench;
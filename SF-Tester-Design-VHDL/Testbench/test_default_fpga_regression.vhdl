@@ -50,7 +50,9 @@ configuration test_default_fpga_regression of fpga_serial_mem_tester_testharness
 
             for simulation
                 for uut_fpga_serial_mem_tester : fpga_serial_mem_tester
-                    use entity work.fpga_serial_mem_tester(rtl);
+                    -- bind the generic tester component to the Arty A7-100 top,
+                    -- which has the same ports
+                    use entity work.fpga_serial_mem_tester_a7100(rtl);
                 end for;
 
                 -- select
@@ -0,0 +1,141 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file amp_ring.c
+ *
+ * @brief
+ * Lock-free single-producer single-consumer rings in on-chip memory, carrying
+ * the LED, CLS and print events of the SF3 test engine on CPU1 to the user
+ * interface tasks on CPU0 when the application is split across both cores.
+ *
+ * Each ring has one producer task on CPU1 and one consumer task on CPU0. The
+ * producer alone writes the head index and the consumer alone writes the tail
+ * index, so neither core takes a lock or enters a critical section. A data
+ * memory barrier orders the slot copy against the index update.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include <string.h>
+#include "xil_io.h"
+#include "xil_mmu.h"
+#include "xpseudo_asm.h"
+#include "amp_ring.h"
+
+/* Translation table attributes of a strongly-ordered, shareable section. */
+#define AMP_RING_TLB_ATTRIBUTES 0x14de2
+
+/* CPU1 reads its start address here after the boot ROM parks it in WFE. */
+#define AMP_CPU1_WAKEUP_VECTOR 0xFFFFFFF0U
+
+/* Written by CPU0 once the rings are reset, and read by CPU1 before use. */
+#define AMP_RING_MAGIC 0x53463352U
+
+typedef struct AMP_RING_DESC_TAG {
+	volatile u32 head;
+	volatile u32 tail;
+	u8 slots[AMP_RING_SLOT_COUNT][AMP_RING_SLOT_SIZE];
+} t_amp_ring;
+
+typedef struct AMP_RING_SHARED_TAG {
+	volatile u32 magic;
+	t_amp_ring rings[AMP_RING_CHANNEL_COUNT];
+} t_amp_ring_shared;
+
+#define AMP_RING_SHARED ((t_amp_ring_shared*) AMP_RING_BASEADDR)
+
+/* Map the shared region on this core; the UI core also resets the rings. */
+void AmpRing_Init(void)
+{
+	t_amp_ring_shared* shared = AMP_RING_SHARED;
+
+	Xil_SetTlbAttributes(AMP_RING_BASEADDR, AMP_RING_TLB_ATTRIBUTES);
+
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_ENGINE
+	while (shared->magic != AMP_RING_MAGIC) {
+		/* Wait for CPU0 to reset the rings. */
+	}
+	dmb();
+#else
+	for (int iChan = 0; iChan < AMP_RING_CHANNEL_COUNT; ++iChan) {
+		shared->rings[iChan].head = 0;
+		shared->rings[iChan].tail = 0;
+	}
+	dmb();
+	shared->magic = AMP_RING_MAGIC;
+	dmb();
+#endif
+}
+
+/* Release CPU1 from the boot ROM wait loop to run the engine application. */
+void AmpRing_StartEngineCpu(void)
+{
+	Xil_Out32(AMP_CPU1_WAKEUP_VECTOR, AMP_CPU1_START_ADDR);
+	dsb();
+	sev();
+}
+
+/* Copy one event into the ring of the channel; returns false when full,
+ * leaving the event for the producer to post again. */
+bool AmpRing_Post(int channel, const void* event, u32 eventSize)
+{
+	t_amp_ring* ring = &(AMP_RING_SHARED->rings[channel]);
+	const u32 head = ring->head;
+
+	if ((head - ring->tail) >= AMP_RING_SLOT_COUNT)
+		return false;
+
+	memcpy(ring->slots[head % AMP_RING_SLOT_COUNT], event,
+			(eventSize < AMP_RING_SLOT_SIZE) ? eventSize : AMP_RING_SLOT_SIZE);
+	dmb();
+	ring->head = head + 1;
+
+	return true;
+}
+
+/* Copy the oldest event out of the ring of the channel; returns false when
+ * the ring is empty. */
+bool AmpRing_Fetch(int channel, void* event, u32 eventSize)
+{
+	t_amp_ring* ring = &(AMP_RING_SHARED->rings[channel]);
+	const u32 tail = ring->tail;
+
+	if (ring->head == tail)
+		return false;
+
+	dmb();
+	memcpy(event, ring->slots[tail % AMP_RING_SLOT_COUNT],
+			(eventSize < AMP_RING_SLOT_SIZE) ? eventSize : AMP_RING_SLOT_SIZE);
+	dmb();
+	ring->tail = tail + 1;
+
+	return true;
+}
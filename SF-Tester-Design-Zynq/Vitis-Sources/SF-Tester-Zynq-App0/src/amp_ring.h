@@ -0,0 +1,89 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file amp_ring.h
+ *
+ * @brief
+ * Lock-free single-producer single-consumer rings in on-chip memory, carrying
+ * the LED, CLS and print events of the SF3 test engine on CPU1 to the user
+ * interface tasks on CPU0 when the application is split across both cores.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_AMP_RING_H_
+#define SRC_AMP_RING_H_
+
+#include <stdbool.h>
+#include "xil_types.h"
+
+/* Build role of the application, set per Vitis application project with
+ * -DSF3_AMP_ROLE=<n>. The default single-core role runs every task on CPU0.
+ * The UI role runs the LED, CLS and PRINT tasks on CPU0 and starts CPU1; the
+ * engine role runs the SF3 and SF3X tasks on CPU1. */
+#define SF3_AMP_ROLE_NONE 0
+#define SF3_AMP_ROLE_UI 1
+#define SF3_AMP_ROLE_ENGINE 2
+
+#ifndef SF3_AMP_ROLE
+#define SF3_AMP_ROLE SF3_AMP_ROLE_NONE
+#endif
+
+/* Shared ring region at the base of the high on-chip memory, mapped as
+ * strongly-ordered on both cores so that no cache maintenance is needed. */
+#ifndef AMP_RING_BASEADDR
+#define AMP_RING_BASEADDR 0xFFFF0000U
+#endif
+
+/* Start address of the CPU1 application, matching its linker script, that
+ * CPU0 writes to the CPU1 wake-up vector. */
+#ifndef AMP_CPU1_START_ADDR
+#define AMP_CPU1_START_ADDR 0x10000000U
+#endif
+
+/* Slots per ring, a power of two, and the payload size of one slot; each
+ * event fits one slot. */
+#define AMP_RING_SLOT_COUNT 16
+#define AMP_RING_SLOT_SIZE 48
+
+enum AMP_RING_CHANNEL_TAG {
+	AMP_RING_CHANNEL_LED,
+	AMP_RING_CHANNEL_CLS,
+	AMP_RING_CHANNEL_PRINT,
+	AMP_RING_CHANNEL_COUNT
+};
+
+void AmpRing_Init(void);
+void AmpRing_StartEngineCpu(void);
+bool AmpRing_Post(int channel, const void* event, u32 eventSize);
+bool AmpRing_Fetch(int channel, void* event, u32 eventSize);
+
+#endif /* SRC_AMP_RING_H_ */
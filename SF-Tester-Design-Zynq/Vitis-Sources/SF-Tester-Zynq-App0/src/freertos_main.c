@@ -57,6 +57,9 @@
 #include "PmodSF3.h"
 #include "PWM.h"
 #include "led_pwm.h"
+#include "sf3_log.h"
+#include "sf3_console.h"
+#include "amp_ring.h"
 #include "Experiment.h"
 
 /*-----------------------------------------------------------*/
@@ -64,23 +67,58 @@
 /* Task handles for controlling real-time tasks */
 static TaskHandle_t xLedTask;
 static TaskHandle_t xClsTask;
-static TaskHandle_t xSf3Task;
+static TaskHandle_t xSf3Task[SF3_DEVICE_COUNT];
+static TaskHandle_t xSf3XferTask[SF3_DEVICE_COUNT];
 static TaskHandle_t xPrintTask;
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_ENGINE
+static TaskHandle_t xAmpForwardTask[AMP_RING_CHANNEL_PRINT];
+#elif SF3_AMP_ROLE == SF3_AMP_ROLE_UI
+static TaskHandle_t xAmpRelayTask;
+#endif
+
+/* Width of a PMOD CLS text row, and the longest run of unchanged characters
+ * that is rewritten instead of costing a further cursor-positioning escape. */
+#define CLS_ROW_CHAR_COUNT 16
+#define CLS_RUN_MERGE_GAP 4
+
+/* Build with -DSF3_CLS_UPDATE_CRITICAL=1 to run the CLS initialization, each
+ * CLS update and each LED PWM update with the interrupts masked, as before the
+ * CLS and LED tasks owned their peripherals, so that the QSPI interrupt
+ * latency printed by the SF3 tasks can be compared with the baseline. */
+#ifndef SF3_CLS_UPDATE_CRITICAL
+#define SF3_CLS_UPDATE_CRITICAL 0
+#endif
+
+/* Size of the batch of terminal log lines printed by one UART write */
+#define LOG_BATCH_SZ 256
 
 /* Queues for generating update events */
-QueueHandle_t xQueuePrint = NULL;
 QueueHandle_t xQueueLedConfig = NULL;
 QueueHandle_t xQueueClsDispl = NULL;
+QueueHandle_t xQueueSf3Xfer[SF3_DEVICE_COUNT];
+QueueHandle_t xQueueSf3XferDone[SF3_DEVICE_COUNT];
 
 /* The real-time tasks of this program. */
 static void prvLedTask( void *pvParameters ); /* Update LEDs on events */
 static void prvClsTask( void *pvParameters ); /* Print to PMOD CLS on events */
 static void prvSf3Task( void *pvParameters ); /* Master task, operate PMOD ACL2 and generate events. */
-static void prvPrintTask( void *pvParameters ); /* Print to UARTlite on events */
+static void prvSf3XferTask( void *pvParameters ); /* Perform PMOD SF3 transfers queued by the master task. */
+static void prvPrintTask( void *pvParameters ); /* Print the terminal log to the console UART */
+static bool prvClsWriteChangedRuns( PmodCLS* clsDevice, char* shadowLine,
+		u8 idxRow, const char* line ); /* Write only the changed text of one CLS row */
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_ENGINE
+static void prvAmpForwardTask( void *pvParameters ); /* Forward events of one queue to CPU0 */
+#elif SF3_AMP_ROLE == SF3_AMP_ROLE_UI
+static void prvAmpRelayTask( void *pvParameters ); /* Relay events from CPU1 to the queues */
+#endif
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_NONE
+static QueueHandle_t prvAmpChannelQueue( int channel, u32* eventSize );
+#endif
 
 /*-----------------------------------------------------------*/
 int main( void )
 {
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_ENGINE
 	/* Create a task to receive events for updating LED color palette for eight LEDs of the Arty-A7-100. */
 	xTaskCreate( prvLedTask,
 				 (const char*) "LC",
@@ -96,16 +134,34 @@ int main( void )
 				 NULL,
 				 tskIDLE_PRIORITY,
 				 &xClsTask );
+#endif
+
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_UI
+	for (int iDev = 0; iDev < SF3_DEVICE_COUNT; ++iDev) {
+		char taskName[configMAX_TASK_NAME_LEN];
+
+		/* Create a task to read updates from the PMOD SF3, and send queue updates for LED, CLS, Printf . */
+		snprintf(taskName, sizeof(taskName), "SF3%d", iDev);
+		xTaskCreate( prvSf3Task,
+					 (const char*) taskName,
+					 configMINIMAL_STACK_SIZE + (2*1024),
+					 (void*)(UINTPTR) iDev,
+					 tskIDLE_PRIORITY + 2,
+					 &(xSf3Task[iDev]));
+
+		/* Create a task to perform the PMOD SF3 page transfers while the SF3 task prepares the next page. */
+		snprintf(taskName, sizeof(taskName), "SF3X%d", iDev);
+		xTaskCreate( prvSf3XferTask,
+					 (const char*) taskName,
+					 configMINIMAL_STACK_SIZE + (1*1024),
+					 (void*)(UINTPTR) iDev,
+					 tskIDLE_PRIORITY + 3,
+					 &(xSf3XferTask[iDev]));
+	}
+#endif
 
-	/* Create a task to read updates from the PMOD SF3, and send queue updates for LED, CLS, Printf . */
-	xTaskCreate( prvSf3Task,
-				 (const char*) "SF3",
-				 configMINIMAL_STACK_SIZE + (2*1024),
-				 NULL,
-				 tskIDLE_PRIORITY + 2,
-				 &xSf3Task);
-
-	/* Create a task to receive strings to print to the UART via xil_printf(). */
+	/* Create a task to format the terminal log and queue it to the UART via Console_Write(),
+	 * or on CPU1 of the dual-core split, to forward the lines to CPU0. */
 	xTaskCreate( prvPrintTask,
 				 ( const char * ) "PRINT",
 				 configMINIMAL_STACK_SIZE,
@@ -113,14 +169,43 @@ int main( void )
 				 tskIDLE_PRIORITY + 1,
 				 &xPrintTask );
 
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_ENGINE
+	/* Create a task per event queue to forward the events of the test engine to
+	 * the user interface on CPU0, the only producer of its ring; the print task
+	 * forwards the terminal log lines. */
+	for (int iChan = 0; iChan < AMP_RING_CHANNEL_PRINT; ++iChan) {
+		xTaskCreate( prvAmpForwardTask,
+					 (const char*) "AMPF",
+					 configMINIMAL_STACK_SIZE,
+					 (void*)(UINTPTR) iChan,
+					 tskIDLE_PRIORITY + 1,
+					 &(xAmpForwardTask[iChan]));
+	}
+#elif SF3_AMP_ROLE == SF3_AMP_ROLE_UI
+	/* Create a task to relay the events of the test engine on CPU1 to the LED
+	 * and CLS queues and the terminal log. */
+	xTaskCreate( prvAmpRelayTask,
+				 (const char*) "AMPR",
+				 configMINIMAL_STACK_SIZE,
+				 NULL,
+				 tskIDLE_PRIORITY + 1,
+				 &xAmpRelayTask );
+#endif
+
 	/* Create the LED configuration Queue for receiving events for LED configuration. */
 	xQueueLedConfig = xQueueCreate(10, sizeof(t_rgb_led_palette_silk));
 
 	/* Create the 16x2 dot-matrix LCD display receiving text updates queue. */
 	xQueueClsDispl = xQueueCreate(4, sizeof(t_cls_lines));
 
-	/* Create the serial console printf() queue for short strings to print to console. */
-	xQueuePrint = xQueueCreate(4, PRINTF_BUF_SZ);
+	/* Notify the print task of each record committed to the terminal log. */
+	Log_Init(xPrintTask);
+
+	/* Create the SF3 transfer request and completion queues, one entry per ping-pong buffer. */
+	for (int iDev = 0; iDev < SF3_DEVICE_COUNT; ++iDev) {
+		xQueueSf3Xfer[iDev] = xQueueCreate(SF3_XFER_BUFFER_COUNT, sizeof(t_sf3_xfer));
+		xQueueSf3XferDone[iDev] = xQueueCreate(SF3_XFER_BUFFER_COUNT, sizeof(t_sf3_xfer));
+	}
 
 	/* Check the queue was created. */
 	configASSERT(xQueueLedConfig);
@@ -128,8 +213,27 @@ int main( void )
 	/* Check the queue was created. */
 	configASSERT(xQueueClsDispl);
 
-	/* Check the queue was created. */
-	configASSERT(xQueuePrint);
+	/* Check the queues were created. */
+	for (int iDev = 0; iDev < SF3_DEVICE_COUNT; ++iDev) {
+		configASSERT(xQueueSf3Xfer[iDev]);
+		configASSERT(xQueueSf3XferDone[iDev]);
+	}
+
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_NONE
+	/* Check that each event fits one slot of the rings between the cores. */
+	configASSERT(sizeof(t_rgb_led_palette_silk) <= AMP_RING_SLOT_SIZE);
+	configASSERT(sizeof(t_cls_lines) <= AMP_RING_SLOT_SIZE);
+	configASSERT(LOG_LINE_SZ <= AMP_RING_SLOT_SIZE);
+	configASSERT(LOG_LINE_SZ <= sizeof(((t_log_record*) NULL)->text));
+
+	/* Map the rings between the cores, resetting them on CPU0. */
+	AmpRing_Init();
+#endif
+
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_UI
+	/* Start the test engine application on CPU1 now that the rings are reset. */
+	AmpRing_StartEngineCpu();
+#endif
 
 	/* Start the tasks and timer running. */
 	vTaskStartScheduler();
@@ -146,6 +250,10 @@ int main( void )
 static void prvLedTask( void *pvParameters )
 {
 	t_rgb_led_palette_silk currLedConfig;
+
+	/* This task is the only owner of the LED PWMs, so the register writes
+	 * need no critical section, other than in the SF3_CLS_UPDATE_CRITICAL
+	 * build of the baseline. */
 	InitAllLedsOff();
 
 	for (;;)
@@ -153,7 +261,9 @@ static void prvLedTask( void *pvParameters )
 		/* Block on LED configuration queue to receive the next incoming event. */
 		xQueueReceive(xQueueLedConfig, &currLedConfig, portMAX_DELAY);
 
+#if SF3_CLS_UPDATE_CRITICAL
 		taskENTER_CRITICAL();
+#endif
 		if (currLedConfig.ledSilk < 4) {
 			SetBasicLedPercent(currLedConfig.ledSilk, currLedConfig.rgb.paletteGreen);
 		} else if (currLedConfig.ledSilk == 4) {
@@ -161,7 +271,9 @@ static void prvLedTask( void *pvParameters )
 		} else if (currLedConfig.ledSilk < 7) {
 			SetRgbPaletteLed(currLedConfig.ledSilk, &(currLedConfig.rgb));
 		}
+#if SF3_CLS_UPDATE_CRITICAL
 		taskEXIT_CRITICAL();
+#endif
 	}
 }
 
@@ -170,8 +282,15 @@ static void prvClsTask( void *pvParameters )
 {
 	static PmodCLS clsDevice;
 	t_cls_lines clsLines;
+	static t_cls_lines clsShadow; /* Text currently shown, space padded */
 
+	/* This task is the only owner of the PMOD CLS, so its SPI transfers run
+	 * preemptible and with interrupts enabled, leaving the SF3 QSPI interrupt
+	 * undelayed by a display update. */
+
+#if SF3_CLS_UPDATE_CRITICAL
 	taskENTER_CRITICAL();
+#endif
 
 	/* Initialize the PMOD CLS 16x2 dot-matrix LCD display. */
 	memset(&clsDevice, 0x00, sizeof(clsDevice));
@@ -179,27 +298,79 @@ static void prvClsTask( void *pvParameters )
 
 	/* Clear the display. */
 	CLS_DisplayClear(&clsDevice);
+	memset(clsShadow.line1, ' ', CLS_ROW_CHAR_COUNT);
+	memset(clsShadow.line2, ' ', CLS_ROW_CHAR_COUNT);
 
+#if SF3_CLS_UPDATE_CRITICAL
 	taskEXIT_CRITICAL();
+#endif
 
 	for (;;) {
 		/* Block on CLS lines queue to receive the next incoming display text update. */
 		xQueueReceive(xQueueClsDispl, &clsLines, portMAX_DELAY);
 
+#if SF3_CLS_UPDATE_CRITICAL
 		taskENTER_CRITICAL();
+#endif
+		/* Compare against the shadow of the display and write only the runs of
+		 * characters that changed, skipping the SPI transfers entirely when
+		 * the text is unchanged. A null string on a row blanks that row. */
+		prvClsWriteChangedRuns(&clsDevice, clsShadow.line1, 0, clsLines.line1);
+		prvClsWriteChangedRuns(&clsDevice, clsShadow.line2, 1, clsLines.line2);
+#if SF3_CLS_UPDATE_CRITICAL
+		taskEXIT_CRITICAL();
+#endif
+	}
+}
 
-		if ((strnlen(clsLines.line1, 16) == 0) && (strnlen(clsLines.line2, 16) == 0)) {
-			/* If both lines are only null strings, then clear the display and print nothing. */
-			CLS_DisplayClear(&clsDevice);
-		} else {
-			/* Otherwise, clear the display and print the two lines of text. */
-			CLS_DisplayClear(&clsDevice);
-			CLS_WriteStringAtPos(&clsDevice, 0, 0, clsLines.line1);
-			CLS_WriteStringAtPos(&clsDevice, 1, 0, clsLines.line2);
+/*-----------------------------------------------------------*/
+static bool prvClsWriteChangedRuns( PmodCLS* clsDevice, char* shadowLine,
+		u8 idxRow, const char* line )
+{
+	char target[CLS_ROW_CHAR_COUNT + 1];
+	char run[CLS_ROW_CHAR_COUNT + 1];
+	size_t len = strnlen(line, CLS_ROW_CHAR_COUNT);
+	bool bWritten = false;
+	int iCol = 0;
+
+	/* Pad the row with spaces so that shorter text erases what is left of the
+	 * longer text of the previous update. */
+	memcpy(target, line, len);
+	memset(target + len, ' ', CLS_ROW_CHAR_COUNT - len);
+	target[CLS_ROW_CHAR_COUNT] = '\0';
+
+	while (iCol < CLS_ROW_CHAR_COUNT) {
+		int runStart;
+		int runEnd;
+		int gap = 0;
+
+		if (target[iCol] == shadowLine[iCol]) {
+			++iCol;
+			continue;
 		}
 
-		taskEXIT_CRITICAL();
+		/* Extend the run over short gaps of unchanged characters. */
+		runStart = iCol;
+		runEnd = iCol + 1;
+		for (iCol = runEnd; (iCol < CLS_ROW_CHAR_COUNT) && (gap <= CLS_RUN_MERGE_GAP); ++iCol) {
+			if (target[iCol] != shadowLine[iCol]) {
+				runEnd = iCol + 1;
+				gap = 0;
+			} else {
+				++gap;
+			}
+		}
+
+		memcpy(run, target + runStart, runEnd - runStart);
+		run[runEnd - runStart] = '\0';
+		CLS_WriteStringAtPos(clsDevice, idxRow, runStart, run);
+		memcpy(shadowLine + runStart, run, runEnd - runStart);
+
+		bWritten = true;
+		iCol = runEnd;
 	}
+
+	return bWritten;
 }
 
 /*-----------------------------------------------------------*/
@@ -208,20 +379,125 @@ static void prvSf3Task( void *pvParameters )
 	Experiment_prvSf3Task(pvParameters);
 }
 
+/*-----------------------------------------------------------*/
+static void prvSf3XferTask( void *pvParameters )
+{
+	Experiment_prvSf3XferTask(pvParameters);
+}
+
 /*-----------------------------------------------------------*/
 static void prvPrintTask( void *pvParameters )
 {
-	char Recdstring[PRINTF_BUF_SZ] = "";
+	/* Lines are gathered into one batch per UART write. */
+	static char batchString[LOG_BATCH_SZ];
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_ENGINE
+	u32 batchLen;
+
+	/* Send the batches from the UART interrupt while the task formats more. */
+	Console_Init();
+#endif
 
 	for( ;; )
 	{
-		/* Block to wait for data arriving on the queue. */
-		xQueueReceive( 	xQueuePrint,				/* The queue being read. */
-						Recdstring,	/* Data is read into this address. */
-						portMAX_DELAY );	/* Wait without a timeout for data. */
+		/* Block until a record is committed to the terminal log. */
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_ENGINE
+		/* Forward each line to CPU0, waiting a tick at a time while the ring is full. */
+		while (Log_FormatNext(batchString, LOG_LINE_SZ)) {
+			while (! AmpRing_Post(AMP_RING_CHANNEL_PRINT, batchString, LOG_LINE_SZ)) {
+				vTaskDelay(1);
+			}
+		}
+#else
+		batchLen = 0;
+		while (Log_FormatNext(&(batchString[batchLen]), LOG_LINE_SZ)) {
+			batchLen += strnlen(&(batchString[batchLen]), LOG_LINE_SZ);
+			batchString[batchLen++] = '\r';
+			batchString[batchLen++] = '\n';
+			batchString[batchLen] = '\0';
+
+			if (batchLen + LOG_LINE_SZ + 2 >= LOG_BATCH_SZ) {
+				Console_Write(batchString, batchLen);
+				batchLen = 0;
+			}
+		}
+
+		/* Print the remaining lines. */
+		if (batchLen > 0) {
+			Console_Write(batchString, batchLen);
+		}
+#endif
+	}
+}
+
 
-		/* Print the received data. */
-		xil_printf( "%s\r\n", Recdstring );
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_NONE
+/*-----------------------------------------------------------*/
+static QueueHandle_t prvAmpChannelQueue( int channel, u32* eventSize )
+{
+	switch (channel) {
+	case AMP_RING_CHANNEL_LED:
+		*eventSize = sizeof(t_rgb_led_palette_silk);
+		return xQueueLedConfig;
+	case AMP_RING_CHANNEL_CLS:
+	default:
+		*eventSize = sizeof(t_cls_lines);
+		return xQueueClsDispl;
 	}
 }
+#endif
+
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_ENGINE
+/*-----------------------------------------------------------*/
+static void prvAmpForwardTask( void *pvParameters )
+{
+	const int channel = (int)(UINTPTR) pvParameters;
+	u8 event[AMP_RING_SLOT_SIZE];
+	u32 eventSize;
+	QueueHandle_t xQueue = prvAmpChannelQueue(channel, &eventSize);
+
+	for (;;) {
+		/* Block on the event queue, then post the event to CPU0, waiting a tick
+		 * at a time while the ring is full. */
+		xQueueReceive(xQueue, event, portMAX_DELAY);
 
+		while (! AmpRing_Post(channel, event, eventSize)) {
+			vTaskDelay(1);
+		}
+	}
+}
+#elif SF3_AMP_ROLE == SF3_AMP_ROLE_UI
+/*-----------------------------------------------------------*/
+static void prvAmpRelayTask( void *pvParameters )
+{
+	u8 event[AMP_RING_SLOT_SIZE];
+	u32 eventSize;
+
+	for (;;) {
+		/* Drain every ring into its queue, then poll again on the next tick. */
+		for (int iChan = 0; iChan < AMP_RING_CHANNEL_PRINT; ++iChan) {
+			QueueHandle_t xQueue = prvAmpChannelQueue(iChan, &eventSize);
+
+			while (AmpRing_Fetch(iChan, event, eventSize)) {
+				xQueueSend(xQueue, event, portMAX_DELAY);
+			}
+		}
+
+		/* Log the lines already formatted on CPU1 as text records. */
+		for (;;) {
+			t_log_record* record = Log_Reserve(LOG_SOURCE_RELAY, portMAX_DELAY);
+
+			if (! AmpRing_Fetch(AMP_RING_CHANNEL_PRINT, record->text, LOG_LINE_SZ)) {
+				break;
+			}
+
+			record->eventId = LOG_EVENT_TEXT;
+			record->text[LOG_LINE_SZ - 1] = '\0';
+			Log_Commit(LOG_SOURCE_RELAY);
+		}
+
+		vTaskDelay(1);
+	}
+}
+#endif
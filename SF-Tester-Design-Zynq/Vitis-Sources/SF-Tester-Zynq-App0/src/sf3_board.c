@@ -0,0 +1,206 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_board.c
+ *
+ * @brief
+ * Board support of the SF3 test engine for the Zybo Z7-20.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "xparameters.h"
+#include "xscugic.h"
+#include "xuartps.h"
+#include "amp_ring.h"
+#include "Experiment.h"
+#include "sf3_board.h"
+#include "sf3_console.h"
+
+/* The interrupt controller instance of the FreeRTOS Cortex-A9 port. */
+extern XScuGic xInterruptController;
+
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_ENGINE
+/* PS UART of the console, also the standard output of the BSP */
+static XUartPs boardConsoleUart;
+#endif
+
+/* SF3 device instances of the design, each tested by its own pair of tasks */
+typedef struct BOARD_SF3_CONFIG_DESC_TAG {
+	u32 spiBaseAddr;
+	u32 intcVecId;
+	u32 qspiIntr;
+} t_board_sf3_config;
+
+static const t_board_sf3_config c_board_sf3_configs[SF3_DEVICE_COUNT] = {
+	{XPAR_PMODSF3_0_AXI_LITE_SPI_BASEADDR, XPAR_FABRIC_PMODSF3_0_VEC_ID,
+			XPAR_FABRIC_PMODSF3_0_QSPI_INTERRUPT_INTR},
+#if SF3_DEVICE_COUNT > 1
+	{XPAR_PMODSF3_1_AXI_LITE_SPI_BASEADDR, XPAR_FABRIC_PMODSF3_1_VEC_ID,
+			XPAR_FABRIC_PMODSF3_1_QSPI_INTERRUPT_INTR},
+#endif
+#if SF3_DEVICE_COUNT > 2
+	{XPAR_PMODSF3_2_AXI_LITE_SPI_BASEADDR, XPAR_FABRIC_PMODSF3_2_VEC_ID,
+			XPAR_FABRIC_PMODSF3_2_QSPI_INTERRUPT_INTR},
+#endif
+#if SF3_DEVICE_COUNT > 3
+	{XPAR_PMODSF3_3_AXI_LITE_SPI_BASEADDR, XPAR_FABRIC_PMODSF3_3_VEC_ID,
+			XPAR_FABRIC_PMODSF3_3_QSPI_INTERRUPT_INTR},
+#endif
+};
+
+const u8 c_board_rgb_led_silks[BOARD_RGB_LED_COUNT] = {5, 6};
+
+const u8 c_board_status_led_silks[BOARD_STATUS_LED_COUNT] = {0, 1, 2, 3};
+
+/* The RGB LED lit by each of test patterns A through H. */
+const t_board_rgb_led_lit c_board_pattern_leds[BOARD_PATTERN_LED_COUNT] = {
+	{0, {0, 0xFF, 0}},
+	{1, {0, 0xFF, 0}},
+	{0, {0, 0, 0xFF}},
+	{1, {0, 0, 0xFF}},
+	{0, {0xFF, 0xFF, 0}},
+	{1, {0xFF, 0xFF, 0}},
+	{0, {0xFF, 0, 0xFF}},
+	{1, {0xFF, 0, 0xFF}}
+};
+
+/* The RGB LED lit by each step of the test, from the erase to the final
+ * display. */
+const t_board_rgb_led_lit c_board_step_leds[BOARD_LED_STEP_NONE] = {
+	{0, {0x80, 0x80, 0x80}},
+	{0, {0x70, 0x10, 0}},
+	{1, {0x80, 0x80, 0x80}},
+	{1, {0x70, 0x10, 0}},
+	{0, {0, 0x80, 0x80}},
+	{0, {0x70, 0x10, 0}},
+	{1, {0, 0x80, 0x80}}
+};
+
+/* Initialize the PMOD SF3 driver targeted at FreeRTOS (instead of the regular
+ * PMOD SF3 driver targeted at standalone), with the interrupt of the device
+ * connected to the GIC of this core.
+ */
+XStatus Board_Sf3Begin(PmodSF3* InstancePtr, int deviceIndex)
+{
+	const t_board_sf3_config* devConfig = &(c_board_sf3_configs[deviceIndex]);
+	XStatus Status;
+
+	taskENTER_CRITICAL();
+	Status = SF3_begin_freertos(InstancePtr,
+			devConfig->spiBaseAddr,
+			devConfig->intcVecId,
+			devConfig->qspiIntr);
+
+	/* Enter the QSPI interrupt through the engine, which stamps its latency
+	 * before calling the driver handler. */
+	if (Status == XST_SUCCESS) {
+		Status = XScuGic_Connect(&xInterruptController, devConfig->intcVecId,
+				(Xil_ExceptionHandler) Experiment_Sf3IntrHandler,
+				(void*)(UINTPTR) deviceIndex);
+	}
+
+#if SF3_AMP_ROLE == SF3_AMP_ROLE_ENGINE
+	/* Route the QSPI interrupt to this core only. The distributor init of
+	 * CPU0 targets the interrupts of the fabric at CPU0, which has no handler
+	 * connected and would otherwise also take and acknowledge it. */
+	XScuGic_InterruptUnmapFromCpu(&xInterruptController, 0, devConfig->qspiIntr);
+	XScuGic_InterruptMaptoCpu(&xInterruptController, XPAR_CPU_ID, devConfig->qspiIntr);
+#endif
+	taskEXIT_CRITICAL();
+
+	return Status;
+}
+
+/* The Zynq design connects only the PmodSF3 interrupts to the fabric
+ * interrupts of the PS, so the SF3 tasks sample the switches and buttons on
+ * their period instead. */
+XStatus Board_UserInputsBegin(XGpio* InstancePtr, XInterruptHandler handler,
+		void* callbackRef)
+{
+	return XST_NO_FEATURE;
+}
+
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_ENGINE
+/* Called by the PS UART interrupt handler; only the end of a send is used. */
+static void Board_ConsoleHandler(void* callbackRef, u32 event, unsigned int eventData)
+{
+	if (event == XUARTPS_EVENT_SENT_DATA) {
+		Console_SendDone();
+	}
+}
+#endif
+
+/* Initialize the PS UART of the console at SF3_CONSOLE_BAUD, to send from its
+ * interrupt, which refills the 64 byte FIFO as it empties. On CPU1 of the
+ * dual-core split, CPU0 owns the console.
+ */
+XStatus Board_ConsoleBegin(void)
+{
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_ENGINE
+	XUartPs_Config* uartConfig = XUartPs_LookupConfig(XPAR_XUARTPS_0_DEVICE_ID);
+	XStatus Status;
+
+	if ((uartConfig == NULL) ||
+			(XUartPs_CfgInitialize(&boardConsoleUart, uartConfig, uartConfig->BaseAddress) != XST_SUCCESS) ||
+			(XUartPs_SetBaudRate(&boardConsoleUart, SF3_CONSOLE_BAUD) != XST_SUCCESS)) {
+		return XST_FAILURE;
+	}
+
+	XUartPs_SetHandler(&boardConsoleUart, (XUartPs_Handler) Board_ConsoleHandler, NULL);
+
+	/* The driver sends from its interrupt only while a receive interrupt is
+	 * enabled; the receive overrun is the least frequent of them. */
+	XUartPs_SetInterruptMask(&boardConsoleUart, XUARTPS_IXR_RXOVR);
+
+	taskENTER_CRITICAL();
+	Status = XScuGic_Connect(&xInterruptController, XPAR_XUARTPS_1_INTR,
+			(Xil_ExceptionHandler) XUartPs_InterruptHandler, &boardConsoleUart);
+	if (Status == XST_SUCCESS) {
+		XScuGic_Enable(&xInterruptController, XPAR_XUARTPS_1_INTR);
+	}
+	taskEXIT_CRITICAL();
+
+	return Status;
+#else
+	return XST_NO_FEATURE;
+#endif
+}
+
+/* Start the send of the bytes, which stay in place until the send is done. */
+void Board_ConsoleSend(const u8* buffer, u32 byteCount)
+{
+#if SF3_AMP_ROLE != SF3_AMP_ROLE_ENGINE
+	XUartPs_Send(&boardConsoleUart, (u8*) buffer, byteCount);
+#endif
+}
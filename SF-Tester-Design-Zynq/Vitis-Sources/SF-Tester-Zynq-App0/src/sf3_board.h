@@ -0,0 +1,117 @@
+/**-----------------------------------------------------------------------------
+-- MIT License
+--
+-- Copyright (c) 2026 Timothy Stotts
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+------------------------------------------------------------------------------*/
+/**-----------------------------------------------------------------------------
+ * @file sf3_board.h
+ *
+ * @brief
+ * Board support of the SF3 test engine for the Zybo Z7-20: the PmodSF3
+ * instances and their interrupts, the LEDs that display the test, and the
+ * placement of the transfer buffers. Experiment.c is the same for every board.
+ *
+ * @author
+ * Timothy Stotts (timothystotts08@gmail.com)
+ *
+ * @copyright
+ * (c) 2026 Copyright Timothy Stotts
+ *
+ * This program is free software; distributed under the terms of the MIT
+ * License.
+------------------------------------------------------------------------------*/
+
+#ifndef SRC_SF3_BOARD_H_
+#define SRC_SF3_BOARD_H_
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xgpio.h"
+#include "PmodSF3.h"
+#include "led_pwm.h"
+
+/* Count of ping-pong buffers in flight between the SF3 and transfer tasks. */
+#ifndef SF3_XFER_BUFFER_COUNT
+#define SF3_XFER_BUFFER_COUNT 2
+#endif
+
+/* Build with -DSF3_XFER_BUFFER_OCM=1 to place the transfer buffers in the low
+ * on-chip memory, given an output section .sf3_xfer_ocm mapped to ps7_ram_0
+ * in the linker script; the buffers of one device fill most of that memory. */
+#ifndef SF3_XFER_BUFFER_OCM
+#define SF3_XFER_BUFFER_OCM 0
+#endif
+#if SF3_XFER_BUFFER_OCM
+#define BOARD_XFER_BUFFER_SECTION __attribute__((section(".sf3_xfer_ocm")))
+#define BOARD_XFER_BUFFER_MAX_BYTES 0x30000
+#else
+#define BOARD_XFER_BUFFER_SECTION
+#endif
+
+/* Baud rate the console sets in the PS UART, whose 100 MHz reference clock
+ * divides it within 0.5 percent. */
+#ifndef SF3_CONSOLE_BAUD
+#define SF3_CONSOLE_BAUD 921600
+#endif
+
+/* LED silk indices of the board, below BOARD_LED_SILK_COUNT: the RGB LEDs
+ * that display the selected test pattern and the step of the test, and the
+ * basic LEDs that display the pass and done statuses of all of the devices. */
+#define BOARD_LED_SILK_COUNT 7
+#define BOARD_RGB_LED_COUNT 2
+#define BOARD_STATUS_LED_COUNT 4
+#define BOARD_STATUS_LED_PASS 0
+#define BOARD_STATUS_LED_DONE 1
+
+/* Count of the test patterns, A through H, displayed on the RGB LEDs. */
+#define BOARD_PATTERN_LED_COUNT 8
+
+/* Steps of the test displayed on the RGB LEDs. */
+enum BOARD_LED_STEP_TAG {
+	BOARD_LED_STEP_ERASE_START,
+	BOARD_LED_STEP_ERASE_DONE,
+	BOARD_LED_STEP_PAGE_START,
+	BOARD_LED_STEP_PAGE_DONE,
+	BOARD_LED_STEP_READ_START,
+	BOARD_LED_STEP_READ_DONE,
+	BOARD_LED_STEP_FINAL,
+	BOARD_LED_STEP_NONE
+};
+
+/* The one RGB LED lit to display a test pattern or step, by its index in
+ * c_board_rgb_led_silks, and its color; the other RGB LEDs are off. */
+typedef struct BOARD_RGB_LED_LIT_TAG {
+	u8 rgbIndex;
+	t_rgb_led_palette rgb;
+} t_board_rgb_led_lit;
+
+extern const u8 c_board_rgb_led_silks[BOARD_RGB_LED_COUNT];
+extern const u8 c_board_status_led_silks[BOARD_STATUS_LED_COUNT];
+extern const t_board_rgb_led_lit c_board_pattern_leds[BOARD_PATTERN_LED_COUNT];
+extern const t_board_rgb_led_lit c_board_step_leds[BOARD_LED_STEP_NONE];
+
+XStatus Board_Sf3Begin(PmodSF3* InstancePtr, int deviceIndex);
+XStatus Board_UserInputsBegin(XGpio* InstancePtr, XInterruptHandler handler,
+		void* callbackRef);
+XStatus Board_ConsoleBegin(void);
+void Board_ConsoleSend(const u8* buffer, u32 byteCount);
+
+#endif /* SRC_SF3_BOARD_H_ */